@@ -0,0 +1,141 @@
+# benchmarks.cmake
+#
+# Benchmark targets.
+#
+# Copyright (c) 2026 vcdMaker team
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+# Benchmarks
+
+set(COMMON_BENCHMARK_DIR common/test/benchmark)
+
+set(OUTPUT_BENCHMARK_DIR output/benchmark)
+
+# Add master benchmarking target.
+add_custom_target(benchmark
+                  COMMENT "vcdMaker benchmarks")
+
+# Function for benchmark creation.
+function(add_vcdtools_benchmark BENCHMARK_NAME BENCHMARK_SOURCES)
+    add_executable(${BENCHMARK_NAME} EXCLUDE_FROM_ALL ${BENCHMARK_SOURCES})
+
+    target_include_directories(${BENCHMARK_NAME} PUBLIC ${COMMON_HEADERS_DIR} ${PARSER_HEADERS_DIR} ${PARSER_GEN_HEADERS_DIR})
+
+    target_link_libraries(${BENCHMARK_NAME} Threads::Threads)
+
+    add_common_vcdtools_target_props(${BENCHMARK_NAME})
+
+    set_target_properties(${BENCHMARK_NAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${OUTPUT_BENCHMARK_DIR})
+
+    add_custom_target(run_${BENCHMARK_NAME}
+                      COMMAND ${BENCHMARK_NAME}
+                      DEPENDS ${BENCHMARK_NAME})
+    add_dependencies(benchmark run_${BENCHMARK_NAME})
+endfunction(add_vcdtools_benchmark)
+
+# List of benchmarks.
+
+set(BENCHMARK_SIGNAL_SORT_SOURCES
+    ${COMMON_BENCHMARK_DIR}/SignalSort.cpp
+    ${COMMON_SOURCES_DIR}/SignalSorter.cpp
+    ${COMMON_SOURCES_DIR}/ISignal.cpp
+    ${COMMON_SOURCES_DIR}/Signal.cpp
+    ${COMMON_SOURCES_DIR}/Utils.cpp)
+
+add_vcdtools_benchmark(benchmarkSignalSort "${BENCHMARK_SIGNAL_SORT_SOURCES}")
+
+set(BENCHMARK_NUMBER_CONVERSION_SOURCES
+    ${COMMON_BENCHMARK_DIR}/NumberConversion.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp)
+
+add_vcdtools_benchmark(benchmarkNumberConversion "${BENCHMARK_NUMBER_CONVERSION_SOURCES}")
+
+set(BENCHMARK_WARNING_LINES_SOURCES
+    ${COMMON_BENCHMARK_DIR}/WarningLines.cpp
+    ${COMMON_SOURCES_DIR}/ISignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/ISignal.cpp
+    ${COMMON_SOURCES_DIR}/Signal.cpp
+    ${COMMON_SOURCES_DIR}/SourceRegistry.cpp
+    ${COMMON_SOURCES_DIR}/Logger.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/Utils.cpp)
+
+add_vcdtools_benchmark(benchmarkWarningLines "${BENCHMARK_WARNING_LINES_SOURCES}")
+
+set(BENCHMARK_FIELD_LINES_SOURCES
+    ${COMMON_BENCHMARK_DIR}/FieldLines.cpp
+    ${COMMON_SOURCES_DIR}/XmlFieldsSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlGroupSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlISignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlFSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlEventSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/ISignal.cpp
+    ${COMMON_SOURCES_DIR}/FSignal.cpp
+    ${COMMON_SOURCES_DIR}/Signal.cpp
+    ${COMMON_SOURCES_DIR}/SourceRegistry.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimestampConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimeUnit.cpp
+    ${COMMON_SOURCES_DIR}/Utils.cpp
+    ${PARSER_SOURCES})
+
+add_vcdtools_benchmark(benchmarkFieldLines "${BENCHMARK_FIELD_LINES_SOURCES}")
+
+set(BENCHMARK_JSON_LINES_SOURCES
+    ${COMMON_BENCHMARK_DIR}/JsonLines.cpp
+    ${COMMON_SOURCES_DIR}/XmlJsonSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/JsonExtractor.cpp
+    ${COMMON_SOURCES_DIR}/XmlGroupSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlISignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlFSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlEventSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/ISignal.cpp
+    ${COMMON_SOURCES_DIR}/FSignal.cpp
+    ${COMMON_SOURCES_DIR}/Signal.cpp
+    ${COMMON_SOURCES_DIR}/SourceRegistry.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimestampConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimeUnit.cpp
+    ${COMMON_SOURCES_DIR}/Utils.cpp
+    ${PARSER_SOURCES})
+
+add_vcdtools_benchmark(benchmarkJsonLines "${BENCHMARK_JSON_LINES_SOURCES}")
+
+set(BENCHMARK_TIMESTAMP_LINES_SOURCES
+    ${COMMON_BENCHMARK_DIR}/TimestampLines.cpp
+    ${COMMON_SOURCES_DIR}/XmlFieldsSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlGroupSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlISignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlFSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlEventSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/ISignal.cpp
+    ${COMMON_SOURCES_DIR}/FSignal.cpp
+    ${COMMON_SOURCES_DIR}/Signal.cpp
+    ${COMMON_SOURCES_DIR}/SourceRegistry.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimestampConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimeUnit.cpp
+    ${COMMON_SOURCES_DIR}/Utils.cpp
+    ${PARSER_SOURCES})
+
+add_vcdtools_benchmark(benchmarkTimestampLines "${BENCHMARK_TIMESTAMP_LINES_SOURCES}")
@@ -34,6 +34,10 @@ set(COMMON_SOURCES
     ${COMMON_SOURCES_DIR}/SignalFactory.cpp
     ${COMMON_SOURCES_DIR}/XmlEventSignalCreator.cpp
     ${COMMON_SOURCES_DIR}/XmlFSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlGroupSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlFieldsSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlJsonSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/JsonExtractor.cpp
     ${COMMON_SOURCES_DIR}/XmlISignalCreator.cpp
     ${COMMON_SOURCES_DIR}/XmlSignalCreator.cpp
     ${COMMON_SOURCES_DIR}/XmlSignalFactory.cpp
@@ -41,12 +45,24 @@ set(COMMON_SOURCES
     ${COMMON_SOURCES_DIR}/SignalStructureBuilder.cpp
     ${COMMON_SOURCES_DIR}/Signal.cpp
     ${COMMON_SOURCES_DIR}/SignalDb.cpp
+    ${COMMON_SOURCES_DIR}/SignalRuns.cpp
+    ${COMMON_SOURCES_DIR}/SignalSorter.cpp
     ${COMMON_SOURCES_DIR}/SourceRegistry.cpp
     ${COMMON_SOURCES_DIR}/TxtParser.cpp
+    ${COMMON_SOURCES_DIR}/CsvParser.cpp
+    ${COMMON_SOURCES_DIR}/CsvLayout.cpp
+    ${COMMON_SOURCES_DIR}/CsvScanner.cpp
+    ${COMMON_SOURCES_DIR}/BinaryParser.cpp
+    ${COMMON_SOURCES_DIR}/BinaryLayout.cpp
+    ${COMMON_SOURCES_DIR}/MappedFile.cpp
+    ${COMMON_SOURCES_DIR}/PcapParser.cpp
     ${COMMON_SOURCES_DIR}/LogParser.cpp
     ${COMMON_SOURCES_DIR}/LineCounter.cpp
     ${COMMON_SOURCES_DIR}/TimeFrame.cpp
+    ${COMMON_SOURCES_DIR}/ReorderWindow.cpp
     ${COMMON_SOURCES_DIR}/Utils.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimestampConverter.cpp
     ${COMMON_SOURCES_DIR}/TimeUnit.cpp
     ${COMMON_SOURCES_DIR}/Logger.cpp
     ${COMMON_SOURCES_DIR}/VCDTracer.cpp)
@@ -60,6 +76,13 @@ set(COMMON_HEADERS
     ${COMMON_HEADERS_DIR}/LogParser.h
     ${COMMON_HEADERS_DIR}/LineCounter.h
     ${COMMON_HEADERS_DIR}/TxtParser.h
+    ${COMMON_HEADERS_DIR}/CsvParser.h
+    ${COMMON_HEADERS_DIR}/CsvLayout.h
+    ${COMMON_HEADERS_DIR}/CsvScanner.h
+    ${COMMON_HEADERS_DIR}/BinaryParser.h
+    ${COMMON_HEADERS_DIR}/BinaryLayout.h
+    ${COMMON_HEADERS_DIR}/MappedFile.h
+    ${COMMON_HEADERS_DIR}/PcapParser.h
     ${COMMON_HEADERS_DIR}/EventSignalCreator.h
     ${COMMON_HEADERS_DIR}/EventSignal.h
     ${COMMON_HEADERS_DIR}/FSignalCreator.h
@@ -70,6 +93,10 @@ set(COMMON_HEADERS
     ${COMMON_HEADERS_DIR}/SignalFactory.h
     ${COMMON_HEADERS_DIR}/XmlEventSignalCreator.h
     ${COMMON_HEADERS_DIR}/XmlFSignalCreator.h
+    ${COMMON_HEADERS_DIR}/XmlGroupSignalCreator.h
+    ${COMMON_HEADERS_DIR}/XmlFieldsSignalCreator.h
+    ${COMMON_HEADERS_DIR}/XmlJsonSignalCreator.h
+    ${COMMON_HEADERS_DIR}/JsonExtractor.h
     ${COMMON_HEADERS_DIR}/XmlISignalCreator.h
     ${COMMON_HEADERS_DIR}/XmlSignalCreator.h
     ${COMMON_HEADERS_DIR}/XmlSignalFactory.h
@@ -78,11 +105,17 @@ set(COMMON_HEADERS
     ${COMMON_HEADERS_DIR}/Signal.h
     ${COMMON_HEADERS_DIR}/SourceRegistry.h
     ${COMMON_HEADERS_DIR}/SignalDb.h
+    ${COMMON_HEADERS_DIR}/SignalConsumer.h
+    ${COMMON_HEADERS_DIR}/SignalRuns.h
+    ${COMMON_HEADERS_DIR}/SignalSorter.h
     ${COMMON_HEADERS_DIR}/VcdException.h
     ${COMMON_HEADERS_DIR}/VcdExceptionList.h
     ${COMMON_HEADERS_DIR}/Logger.h
     ${COMMON_HEADERS_DIR}/TimeFrame.h
+    ${COMMON_HEADERS_DIR}/ReorderWindow.h
     ${COMMON_HEADERS_DIR}/Utils.h
+    ${COMMON_HEADERS_DIR}/NumberConverter.h
+    ${COMMON_HEADERS_DIR}/TimestampConverter.h
     ${COMMON_HEADERS_DIR}/TimeUnit.h
     ${COMMON_HEADERS_DIR}/Instrument.h
     ${COMMON_HEADERS_DIR}/VCDTracer.h
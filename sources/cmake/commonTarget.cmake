@@ -29,6 +29,9 @@ set(OUTPUT_DIR_ABSOLUE ${CMAKE_CURRENT_BINARY_DIR}/${OUTPUT_DIR})
 # Common sources target name.
 set(COMMON_LIB_TARGET vcdToolsCommon)
 
+# Signals are sorted by multiple threads.
+find_package(Threads REQUIRED)
+
 # Function for setting general target properties.
 function(add_common_vcdtools_target_props TARGET_NAME)
     # Set C++17 support.
@@ -52,6 +55,13 @@ function(add_vcdtools_target TARGET_NAME TARGET_SOURCES TARGET_HEADERS TARGET_HE
 
     target_include_directories(${TARGET_NAME} PUBLIC ${COMMON_HEADERS_DIR} ${TARGET_HEADERS_DIR} ${TCLAP_HEADERS_DIR})
 
+    target_link_libraries(${TARGET_NAME} Threads::Threads)
+
+    # GCC before 9 keeps std::filesystem in a separate library.
+    if ((${CMAKE_CXX_COMPILER_ID} STREQUAL GNU) AND (CMAKE_CXX_COMPILER_VERSION VERSION_LESS 9.0))
+        target_link_libraries(${TARGET_NAME} stdc++fs)
+    endif()
+
     add_common_vcdtools_target_props(${TARGET_NAME})
 
     set_target_properties(${TARGET_NAME} PROPERTIES RUNTIME_OUTPUT_DIRECTORY ${OUTPUT_DIR})
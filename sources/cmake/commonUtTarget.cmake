@@ -37,7 +37,14 @@ set(COMMON_UT_TARGET utCommon)
 function(add_vcdtools_ut UT_NAME UT_SOURCES)
     add_executable(${UT_NAME} EXCLUDE_FROM_ALL $<TARGET_OBJECTS:${COMMON_UT_TARGET}> ${UT_SOURCES})
 
-    target_include_directories(${UT_NAME} PUBLIC ${COMMON_HEADERS_DIR} ${VMAKER_HEADERS_DIR} ${VMERGE_HEADERS_DIR} ${CATCH_HEADERS_DIR})
+    target_include_directories(${UT_NAME} PUBLIC ${COMMON_HEADERS_DIR} ${PARSER_HEADERS_DIR} ${PARSER_GEN_HEADERS_DIR} ${VMAKER_HEADERS_DIR} ${VMERGE_HEADERS_DIR} ${CATCH_HEADERS_DIR})
+
+    target_link_libraries(${UT_NAME} Threads::Threads)
+
+    # GCC before 9 keeps std::filesystem in a separate library.
+    if ((${CMAKE_CXX_COMPILER_ID} STREQUAL GNU) AND (CMAKE_CXX_COMPILER_VERSION VERSION_LESS 9.0))
+        target_link_libraries(${UT_NAME} stdc++fs)
+    endif()
 
     add_common_vcdtools_target_props(${UT_NAME})
 
@@ -28,6 +28,7 @@ set(PARSER_GEN_SOURCES_DIR parsers/auto)
 
 set(PARSER_SOURCES
     ${PARSER_SOURCES_DIR}/Evaluator.cpp
+    ${PARSER_SOURCES_DIR}/ExpressionProgram.cpp
     ${PARSER_SOURCES_DIR}/DecimalNode.cpp
     ${PARSER_SOURCES_DIR}/FloatNode.cpp
     ${PARSER_SOURCES_DIR}/FloatResult.cpp
@@ -50,6 +51,9 @@ set(PARSER_HEADERS
     ${PARSER_HEADERS_DIR}/FloatNode.h
     ${PARSER_HEADERS_DIR}/FloatResult.h
     ${PARSER_HEADERS_DIR}/ExpressionContext.h
+    ${PARSER_HEADERS_DIR}/CaptureCache.h
+    ${PARSER_HEADERS_DIR}/CaptureGroups.h
+    ${PARSER_HEADERS_DIR}/ExpressionProgram.h
     ${PARSER_HEADERS_DIR}/FloatScanner.h
     ${PARSER_HEADERS_DIR}/StringNode.h
     ${PARSER_HEADERS_DIR}/ExpressionNode.h
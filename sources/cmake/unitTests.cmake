@@ -66,3 +66,83 @@ set(UT_TIMEUNIT_SOURCES
     ${COMMON_SOURCES_DIR}/TimeUnit.cpp)
 
 add_vcdtools_ut(utTimeUnit "${UT_TIMEUNIT_SOURCES}")
+
+set(UT_TIMEFRAME_SOURCES
+    ${COMMON_UT_DIR}/TimeFrame.cpp
+    ${COMMON_SOURCES_DIR}/TimeFrame.cpp)
+
+add_vcdtools_ut(utTimeFrame "${UT_TIMEFRAME_SOURCES}")
+
+set(UT_SIGNAL_STRUCTURE_BUILDER_SOURCES
+    ${COMMON_UT_DIR}/SignalStructureBuilder.cpp
+    ${COMMON_SOURCES_DIR}/SignalStructureBuilder.cpp)
+
+add_vcdtools_ut(utSignalStructureBuilder "${UT_SIGNAL_STRUCTURE_BUILDER_SOURCES}")
+
+set(UT_REORDER_WINDOW_SOURCES
+    ${COMMON_UT_DIR}/ReorderWindow.cpp
+    ${COMMON_SOURCES_DIR}/ReorderWindow.cpp)
+
+add_vcdtools_ut(utReorderWindow "${UT_REORDER_WINDOW_SOURCES}")
+
+set(UT_SIGNAL_RUNS_SOURCES
+    ${COMMON_UT_DIR}/SignalRuns.cpp
+    ${COMMON_SOURCES_DIR}/SignalRuns.cpp)
+
+add_vcdtools_ut(utSignalRuns "${UT_SIGNAL_RUNS_SOURCES}")
+
+set(UT_SIGNAL_SORTER_SOURCES
+    ${COMMON_UT_DIR}/SignalSorter.cpp
+    ${COMMON_SOURCES_DIR}/SignalSorter.cpp)
+
+add_vcdtools_ut(utSignalSorter "${UT_SIGNAL_SORTER_SOURCES}")
+
+set(UT_NUMBER_CONVERTER_SOURCES
+    ${COMMON_UT_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp)
+
+add_vcdtools_ut(utNumberConverter "${UT_NUMBER_CONVERTER_SOURCES}")
+
+set(UT_TIMESTAMP_CONVERTER_SOURCES
+    ${COMMON_UT_DIR}/TimestampConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimestampConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimeUnit.cpp)
+
+add_vcdtools_ut(utTimestampConverter "${UT_TIMESTAMP_CONVERTER_SOURCES}")
+
+set(UT_CSV_SCANNER_SOURCES
+    ${COMMON_UT_DIR}/CsvScanner.cpp
+    ${COMMON_SOURCES_DIR}/CsvScanner.cpp)
+
+add_vcdtools_ut(utCsvScanner "${UT_CSV_SCANNER_SOURCES}")
+
+set(UT_JSON_EXTRACTOR_SOURCES
+    ${COMMON_UT_DIR}/JsonExtractor.cpp
+    ${COMMON_SOURCES_DIR}/JsonExtractor.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp)
+
+add_vcdtools_ut(utJsonExtractor "${UT_JSON_EXTRACTOR_SOURCES}")
+
+set(UT_SIGNAL_FACTORY_SOURCES
+    ${COMMON_UT_DIR}/SignalFactory.cpp
+    ${COMMON_SOURCES_DIR}/SignalFactory.cpp
+    ${COMMON_SOURCES_DIR}/XmlSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlISignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlFSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlEventSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlGroupSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlFieldsSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/XmlJsonSignalCreator.cpp
+    ${COMMON_SOURCES_DIR}/JsonExtractor.cpp
+    ${COMMON_SOURCES_DIR}/ISignal.cpp
+    ${COMMON_SOURCES_DIR}/FSignal.cpp
+    ${COMMON_SOURCES_DIR}/Signal.cpp
+    ${COMMON_SOURCES_DIR}/SourceRegistry.cpp
+    ${COMMON_SOURCES_DIR}/Logger.cpp
+    ${COMMON_SOURCES_DIR}/NumberConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimestampConverter.cpp
+    ${COMMON_SOURCES_DIR}/TimeUnit.cpp
+    ${COMMON_SOURCES_DIR}/Utils.cpp
+    ${PARSER_SOURCES})
+
+add_vcdtools_ut(utSignalFactory "${UT_SIGNAL_FACTORY_SOURCES}")
@@ -0,0 +1,199 @@
+/// @file common/inc/BinaryLayout.h
+///
+/// The binary log layout.
+///
+/// @par Full Description
+/// The layout describes the fixed-size records of the binary logs and
+/// creates the signals from them.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <pugixml.hpp>
+
+#include "Signal.h"
+#include "SourceRegistry.h"
+
+namespace PARSER
+{
+    /// The binary log layout class.
+    ///
+    /// Every record holds the timestamp, the signal identifier and
+    /// the value at the given offsets. The identifiers are mapped to
+    /// the vector, real and event signals. The real values are stored
+    /// as the IEEE 754 single or double precision numbers.
+    class BinaryLayout
+    {
+        public:
+
+            /// The field of the record.
+            struct Field
+            {
+                /// The offset of the field within the record.
+                size_t m_Offset;
+
+                /// The width of the field in bytes or 0 if there is no field.
+                size_t m_Width;
+            };
+
+            /// The binary layout constructor.
+            ///
+            /// @throws VcdError if the layout description is invalid.
+            /// @param rXmlFileName The name of the XML file describing the layout.
+            BinaryLayout(const std::string &rXmlFileName);
+
+            /// Returns the record size.
+            size_t GetRecordSize() const
+            {
+                return m_RecordSize;
+            }
+
+            /// Returns the size of the header preceding the records.
+            ///
+            /// The header precedes the records of the binary log file
+            /// or of every captured datagram.
+            size_t GetHeaderSize() const
+            {
+                return m_HeaderSize;
+            }
+
+            /// Returns the UDP destination port of the captured datagrams
+            /// or 0 if the datagrams of all the ports are decoded.
+            uint16_t GetPort() const
+            {
+                return m_Port;
+            }
+
+            /// Returns true if the records hold the timestamps.
+            bool HasTimestamp() const
+            {
+                return (0 != m_Timestamp.m_Width);
+            }
+
+            /// Returns the timestamp of the record.
+            ///
+            /// @param pRecord The record.
+            uint64_t GetTimestamp(const unsigned char *pRecord) const
+            {
+                return Read(pRecord, m_Timestamp);
+            }
+
+            /// Returns the signal identifier of the record.
+            ///
+            /// @param pRecord The record.
+            uint64_t GetId(const unsigned char *pRecord) const
+            {
+                return Read(pRecord, m_Id);
+            }
+
+            /// Creates the signal of the record.
+            ///
+            /// No signal is created if the value exceeds the vector size.
+            /// The warning message is returned instead.
+            ///
+            /// @param pRecord The record.
+            /// @param timestamp The timestamp of the signal.
+            /// @param sourceHandle The signal source handle.
+            /// @param rvpSignals The buffer the signal is appended to.
+            /// @param rWarning The warning message.
+            /// @return False if the signal identifier is unknown.
+            bool CreateSignal(const unsigned char *pRecord,
+                              uint64_t timestamp,
+                              SIGNAL::SourceRegistry::HandleT sourceHandle,
+                              std::vector<SIGNAL::Signal *> &rvpSignals,
+                              std::string &rWarning) const;
+
+        private:
+
+            /// The types of the signals.
+            enum class SignalT
+            {
+                VECTOR,
+                REAL,
+                EVENT
+            };
+
+            /// The signal of the identifier.
+            struct Entry
+            {
+                /// The signal name.
+                std::string m_Name;
+
+                /// The signal type.
+                SignalT m_Type;
+
+                /// The vector size.
+                size_t m_Size;
+            };
+
+            /// Reads the unsigned field of the record.
+            ///
+            /// @param pRecord The record.
+            /// @param rField The field.
+            /// @return The field value.
+            uint64_t Read(const unsigned char *pRecord, const Field &rField) const;
+
+            /// Reads the field description.
+            ///
+            /// @throws VcdError if the description is invalid.
+            /// @param rNode The XML field node.
+            /// @param rField The field.
+            void ReadField(const pugi::xml_node &rNode, Field &rField) const;
+
+            /// Converts the decimal or the '0x' prefixed hexadecimal number.
+            ///
+            /// @param pText The converted text.
+            /// @param rValue The converted value.
+            /// @return False if the text is not a number.
+            static bool ConvertNumber(const char *pText, uint64_t &rValue);
+
+            /// The record size.
+            size_t m_RecordSize;
+
+            /// The size of the header preceding the records.
+            size_t m_HeaderSize;
+
+            /// The UDP destination port of the captured datagrams.
+            uint16_t m_Port;
+
+            /// True if the fields are big endian.
+            bool m_BigEndian;
+
+            /// The timestamp field.
+            Field m_Timestamp;
+
+            /// The signal identifier field.
+            Field m_Id;
+
+            /// The value field.
+            Field m_Value;
+
+            /// The signals of the identifiers.
+            std::unordered_map<uint64_t, Entry> m_Signals;
+    };
+
+}
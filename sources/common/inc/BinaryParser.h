@@ -0,0 +1,79 @@
+/// @file common/inc/BinaryParser.h
+///
+/// The binary log parser.
+///
+/// @par Full Description
+/// The parser creates the signals from the fixed-size records of the
+/// binary log.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include "LogParser.h"
+#include "BinaryLayout.h"
+
+namespace PARSER
+{
+    /// The binary log parser class.
+    ///
+    /// The log file is memory-mapped and the records are decoded in place.
+    class BinaryParser : public LogParser
+    {
+        public:
+
+            /// The binary log parser constructor.
+            ///
+            /// @throws VcdError if the records hold no timestamps.
+            /// @param rFilename The name of the log file to be open.
+            /// @param rTimeBase The time base used in the log.
+            /// @param rSourceRegistry Signal sources registry.
+            /// @param rLayout The layout of the binary log.
+            /// @param verboseMode Value 'true' enables the verbose mode.
+            BinaryParser(const std::string &rFilename,
+                         const std::string &rTimeBase,
+                         SIGNAL::SourceRegistry &rSourceRegistry,
+                         const BinaryLayout &rLayout,
+                         bool verboseMode);
+
+            /// The destructor.
+            ~BinaryParser();
+
+        protected:
+
+            /// Parses the input file.
+            virtual void Parse();
+
+        private:
+
+            /// The layout of the log.
+            const BinaryLayout &m_rLayout;
+
+            /// The number of valid records.
+            uint64_t m_ValidRecords;
+
+            /// The number of invalid records.
+            uint64_t m_InvalidRecords;
+    };
+
+}
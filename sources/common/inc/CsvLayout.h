@@ -0,0 +1,106 @@
+/// @file common/inc/CsvLayout.h
+///
+/// The CSV log layout.
+///
+/// @par Full Description
+/// The layout maps the CSV columns to the signals. It is read from the user
+/// log format XML description.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace PARSER
+{
+    /// The CSV log layout class.
+    ///
+    /// The columns are identified by the names given in the header row.
+    /// The timestamp column holds the integer timestamps. Every mapped
+    /// column holds the values of one vector or real signal.
+    class CsvLayout
+    {
+        public:
+
+            /// The types of the signals in the columns.
+            enum class ColumnT
+            {
+                VECTOR,
+                REAL
+            };
+
+            /// The column of the signal values.
+            struct Column
+            {
+                /// The column header.
+                std::string m_Header;
+
+                /// The signal name.
+                std::string m_Name;
+
+                /// The signal type.
+                ColumnT m_Type;
+
+                /// The vector size.
+                size_t m_Size;
+            };
+
+            /// The CSV layout constructor.
+            ///
+            /// @throws VcdError if the layout description is invalid.
+            /// @param rXmlFileName The name of the XML file describing the layout.
+            CsvLayout(const std::string &rXmlFileName);
+
+            /// Returns the field delimiter.
+            char GetDelimiter() const
+            {
+                return m_Delimiter;
+            }
+
+            /// Returns the name of the timestamp column.
+            const std::string &GetTimestampColumn() const
+            {
+                return m_TimestampColumn;
+            }
+
+            /// Returns the columns of the signal values.
+            const std::vector<Column> &GetColumns() const
+            {
+                return m_Columns;
+            }
+
+        private:
+
+            /// The field delimiter.
+            char m_Delimiter;
+
+            /// The name of the timestamp column.
+            std::string m_TimestampColumn;
+
+            /// The columns of the signal values.
+            std::vector<Column> m_Columns;
+    };
+
+}
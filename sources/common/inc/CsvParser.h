@@ -0,0 +1,171 @@
+/// @file common/inc/CsvParser.h
+///
+/// The CSV log parser.
+///
+/// @par Full Description
+/// The parser creates the vector and real signals from the columns of the
+/// CSV rows. The columns are identified by the header row.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <deque>
+#include <string_view>
+#include <vector>
+
+#include "LogParser.h"
+#include "CsvLayout.h"
+#include "CsvScanner.h"
+
+namespace PARSER
+{
+    /// The CSV log parser class.
+    ///
+    /// The file is read in large blocks. The rows are split with the help of
+    /// the structural characters scanner and the fields refer to the block,
+    /// unless they are quoted and contain escaped quotes. The quoted fields
+    /// may contain the delimiters and the line breaks.
+    class CsvParser : public LogParser
+    {
+        public:
+
+            /// The CSV log parser constructor.
+            ///
+            /// @param rFilename The name of the log file to be open.
+            /// @param rTimeBase The time base used in the log.
+            /// @param rSourceRegistry Signal sources registry.
+            /// @param rLayout The layout of the CSV log.
+            /// @param verboseMode Value 'true' enables the verbose mode.
+            CsvParser(const std::string &rFilename,
+                      const std::string &rTimeBase,
+                      SIGNAL::SourceRegistry &rSourceRegistry,
+                      const CsvLayout &rLayout,
+                      bool verboseMode);
+
+            /// The destructor.
+            ~CsvParser();
+
+        protected:
+
+            /// Parses the input file.
+            virtual void Parse();
+
+        private:
+
+            /// The result of splitting a row.
+            enum class RowT
+            {
+                /// The row has been split.
+                VALID,
+
+                /// The row is malformed.
+                INVALID,
+
+                /// More data is needed to split the row.
+                INCOMPLETE,
+
+                /// There are no more rows.
+                END
+            };
+
+            /// Reads more data keeping the data not parsed yet.
+            ///
+            /// @return False if there is no more data.
+            bool Fill();
+
+            /// Splits the row starting at the beginning of the data.
+            ///
+            /// @param endOfFile True if there is no more data to be read.
+            /// @param rRowEnd The position following the row.
+            /// @return The result of splitting.
+            RowT SplitRow(bool endOfFile, size_t &rRowEnd);
+
+            /// Finds the end of the malformed row.
+            ///
+            /// @param position The position within the row.
+            /// @param endOfFile True if there is no more data to be read.
+            /// @param rRowEnd The position following the row.
+            /// @return INVALID or INCOMPLETE if the row end has not been read yet.
+            RowT SkipRow(size_t position, bool endOfFile, size_t &rRowEnd) const;
+
+            /// Finds the columns of the layout in the header row.
+            ///
+            /// @throws VcdError if a column cannot be found.
+            void MapHeader();
+
+            /// Creates the signals of the row.
+            ///
+            /// @param rowNumber The number of the row.
+            /// @param rvpSignals The buffer of the created signals.
+            /// @return False if the row is invalid.
+            bool CreateSignals(INSTRUMENT::Instrument::LineNumberT rowNumber,
+                               std::vector<SIGNAL::Signal *> &rvpSignals);
+
+            /// Returns the cell without the surrounding spaces.
+            ///
+            /// @param cell The cell.
+            static std::string_view Trim(std::string_view cell);
+
+            /// The initial size of the read block.
+            static const size_t BLOCK_SIZE = 1U << 20;
+
+            /// The layout of the log.
+            const CsvLayout &m_rLayout;
+
+            /// The structural characters scanner.
+            const CsvScanner m_Scanner;
+
+            /// The read data.
+            std::vector<char> m_Buffer;
+
+            /// The position of the data not parsed yet.
+            size_t m_Begin;
+
+            /// The end of the read data.
+            size_t m_End;
+
+            /// The fields of the row.
+            std::vector<std::string_view> m_Fields;
+
+            /// The fields with the escaped quotes replaced.
+            /// The strings are not moved when the new ones are added.
+            std::deque<std::string> m_Unquoted;
+
+            /// The number of the columns in the header row.
+            size_t m_HeaderColumns;
+
+            /// The index of the timestamp column.
+            size_t m_TimestampIndex;
+
+            /// The indexes of the signal columns in the layout order.
+            std::vector<size_t> m_ColumnIndexes;
+
+            /// The number of valid rows.
+            uint64_t m_ValidRows;
+
+            /// The number of invalid rows.
+            uint64_t m_InvalidRows;
+    };
+
+}
@@ -0,0 +1,81 @@
+/// @file common/inc/CsvScanner.h
+///
+/// The CSV structural characters scanner.
+///
+/// @par Full Description
+/// The scanner finds the characters delimiting the CSV fields and rows.
+/// Sixteen characters are compared at a time if SSE2 is available.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+
+namespace PARSER
+{
+    /// The CSV structural characters scanner class.
+    ///
+    /// The structural characters are the field delimiter, the quote,
+    /// the carriage return and the line feed.
+    class CsvScanner
+    {
+        public:
+
+            /// The CSV scanner constructor.
+            ///
+            /// @param delimiter The field delimiter.
+            CsvScanner(char delimiter) :
+                m_Delimiter(delimiter)
+            {
+            }
+
+            /// Finds the first structural character.
+            ///
+            /// @param pData The scanned characters.
+            /// @param size The number of the scanned characters.
+            /// @return The position of the structural character or the size if there is none.
+            size_t Find(const char *pData, size_t size) const;
+
+            /// Returns the field delimiter.
+            char GetDelimiter() const
+            {
+                return m_Delimiter;
+            }
+
+        private:
+
+            /// Returns true if the character is structural.
+            bool IsStructural(char character) const
+            {
+                return (character == m_Delimiter) ||
+                       (character == '"') ||
+                       (character == '\r') ||
+                       (character == '\n');
+            }
+
+            /// The field delimiter.
+            const char m_Delimiter;
+    };
+
+}
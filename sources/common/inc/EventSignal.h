@@ -70,6 +70,17 @@ namespace SIGNAL
                 return "";
             }
 
+            /// @copydoc Signal::Serialize()
+            virtual void Serialize(std::ostream &) const
+            {
+            }
+
+            /// @copydoc Signal::Deserialize()
+            virtual Signal *Deserialize(const TIME::Timestamp &rTimestamp, std::istream &) const
+            {
+                return new EventSignal(m_Name, rTimestamp, m_SourceHandle);
+            }
+
         protected:
 
             /// @copydoc Signal::EqualTo()
@@ -80,6 +80,12 @@ namespace SIGNAL
                 return ("r0.0 " + m_Name);
             }
 
+            /// @copydoc Signal::Serialize()
+            virtual void Serialize(std::ostream &rOut) const;
+
+            /// @copydoc Signal::Deserialize()
+            virtual Signal *Deserialize(const TIME::Timestamp &rTimestamp, std::istream &rIn) const;
+
         protected:
 
             /// @copydoc Signal::EqualTo()
@@ -65,6 +65,20 @@ namespace SIGNAL
                 return new ISignal(*this);
             }
 
+            /// Checks if the value fits the vector.
+            ///
+            /// Vectors wider than 64 bits are not verified here as the constructor
+            /// rejects them anyway.
+            ///
+            /// @param value The value of the signal.
+            /// @param size The size of the vector.
+            /// @return False if the vector is too small to hold the value.
+            static bool IsValueInRange(uint64_t value, size_t size)
+            {
+                return (0 != size) &&
+                       ((size >= 64) || (value <= (std::numeric_limits<uint64_t>::max() >> (64 - size))));
+            }
+
             /// Returns the signal's value.
             uint64_t GetValue() const
             {
@@ -77,6 +91,12 @@ namespace SIGNAL
             /// @copydoc Signal::Footprint()
             virtual std::string Footprint() const;
 
+            /// @copydoc Signal::Serialize()
+            virtual void Serialize(std::ostream &rOut) const;
+
+            /// @copydoc Signal::Deserialize()
+            virtual Signal *Deserialize(const TIME::Timestamp &rTimestamp, std::istream &rIn) const;
+
         protected:
 
             /// @copydoc Signal::EqualTo()
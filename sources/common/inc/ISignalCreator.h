@@ -43,9 +43,16 @@ namespace PARSER
             }
 
             /// @copydoc SignalCreator::Create()
-            virtual SIGNAL::Signal *Create(const std::string &rLogLine,
-                                           INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                           SIGNAL::SourceRegistry::HandleT sourceHandle) const;
+            virtual bool Create(const std::string &rLogLine,
+                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<ISignalCreator>(*this);
+            }
     };
 
 }
@@ -0,0 +1,206 @@
+/// @file common/inc/JsonExtractor.h
+///
+/// The JSON values extractor.
+///
+/// @par Full Description
+/// The extractor finds the values of the given paths in the JSON text
+/// without building the document tree.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PARSER
+{
+    /// The JSON values extractor class.
+    ///
+    /// The paths consist of the object keys and the array indexes separated
+    /// with dots, e.g. "data.samples.0". The text is parsed in one pass
+    /// and the values not on the paths are skipped without being validated.
+    /// Parsing stops as soon as all the values have been found.
+    ///
+    /// The extracted strings refer to the parsed text unless they contain
+    /// escape sequences. The numbers and literals are extracted as written.
+    /// The objects and arrays are extracted as their JSON text.
+    class JsonExtractor
+    {
+        public:
+
+            /// The JSON extractor constructor.
+            JsonExtractor();
+
+            /// Adds the path of the extracted value.
+            ///
+            /// @throws VcdError if the path is invalid.
+            /// @param rPath The path of the value.
+            /// @return The index of the value, the first one having index 1.
+            size_t AddPath(const std::string &rPath);
+
+            /// Returns the number of the paths.
+            size_t GetPathCount() const
+            {
+                return m_Values.size() - 1;
+            }
+
+            /// Extracts the values of the paths.
+            ///
+            /// The whole text is the value of index 0.
+            ///
+            /// @param text The JSON text.
+            /// @return True if the values of all the paths have been found.
+            bool Extract(std::string_view text) const;
+
+            /// Returns the extracted values.
+            ///
+            /// The values are valid until the next extraction and as long as
+            /// the extracted text exists.
+            const std::vector<std::string_view> &GetValues() const
+            {
+                return m_Values;
+            }
+
+        private:
+
+            /// The node of the paths tree.
+            struct Node
+            {
+                /// The object key.
+                std::string m_Key;
+
+                /// The array index or NO_INDEX if the key is not a number.
+                size_t m_Index;
+
+                /// The index of the value or 0 if no path ends in the node.
+                size_t m_Value;
+
+                /// The children nodes.
+                std::vector<size_t> m_Children;
+            };
+
+            /// Parses the value.
+            ///
+            /// @param position The position of the value.
+            /// @param node The paths tree node of the value or NO_NODE.
+            /// @param depth The nesting depth of the value.
+            /// @return The position following the value or NO_POSITION on error.
+            size_t ParseValue(size_t position, size_t node, size_t depth) const;
+
+            /// Parses the object.
+            ///
+            /// @param position The position following the opening brace.
+            /// @param node The paths tree node of the object.
+            /// @param depth The nesting depth of the object.
+            /// @return The position following the object or NO_POSITION on error.
+            size_t ParseObject(size_t position, size_t node, size_t depth) const;
+
+            /// Parses the array.
+            ///
+            /// @param position The position following the opening bracket.
+            /// @param node The paths tree node of the array.
+            /// @param depth The nesting depth of the array.
+            /// @return The position following the array or NO_POSITION on error.
+            size_t ParseArray(size_t position, size_t node, size_t depth) const;
+
+            /// Finds the closing quote of the string.
+            ///
+            /// @param position The position following the opening quote.
+            /// @param rEscaped Set to true if the string contains escape sequences.
+            /// @return The position of the closing quote or NO_POSITION on error.
+            size_t FindStringEnd(size_t position, bool &rEscaped) const;
+
+            /// Skips the object or the array without validating it.
+            ///
+            /// @param position The position following the opening brace or bracket.
+            /// @return The position following the object or array or NO_POSITION on error.
+            size_t SkipContainer(size_t position) const;
+
+            /// Skips the whitespaces.
+            ///
+            /// @param position The position the whitespaces start at.
+            /// @return The position of the first non-whitespace character.
+            size_t SkipWhitespaces(size_t position) const;
+
+            /// Stores the value of the path.
+            ///
+            /// @param node The paths tree node of the value.
+            /// @param value The value as written in the text.
+            /// @param escaped True if the value is a string containing escape sequences.
+            /// @return False if the escape sequences are invalid.
+            bool StoreValue(size_t node, std::string_view value, bool escaped) const;
+
+            /// Replaces the escape sequences of the string.
+            ///
+            /// @param value The string as written in the text.
+            /// @param rUnescaped The string without escape sequences.
+            /// @return False if the escape sequences are invalid.
+            static bool Unescape(std::string_view value, std::string &rUnescaped);
+
+            /// Finds the child node matching the object key.
+            ///
+            /// @param node The parent node.
+            /// @param key The object key.
+            /// @return The child node or NO_NODE.
+            size_t FindKey(size_t node, std::string_view key) const;
+
+            /// Finds the child node matching the array index.
+            ///
+            /// @param node The parent node.
+            /// @param index The array index.
+            /// @return The child node or NO_NODE.
+            size_t FindIndex(size_t node, size_t index) const;
+
+            /// No paths tree node.
+            static const size_t NO_NODE = static_cast<size_t>(-1);
+
+            /// Not an array index.
+            static const size_t NO_INDEX = static_cast<size_t>(-1);
+
+            /// The parsing error.
+            static const size_t NO_POSITION = static_cast<size_t>(-1);
+
+            /// The maximum nesting depth of the parsed values.
+            static const size_t MAX_DEPTH = 64;
+
+            /// The paths tree, the root being the first node.
+            std::vector<Node> m_Nodes;
+
+            /// The parsed text.
+            mutable std::string_view m_Text;
+
+            /// The text followed by the extracted values.
+            /// The storage is reused for every text. Each copy of the extractor
+            /// has its own one.
+            mutable std::vector<std::string_view> m_Values;
+
+            /// The values with the escape sequences replaced.
+            mutable std::vector<std::string> m_Unescaped;
+
+            /// The number of the values not found yet.
+            mutable size_t m_Missing;
+    };
+
+}
@@ -31,6 +31,7 @@
 #pragma once
 
 #include <climits>
+#include <map>
 
 #include "Instrument.h"
 
@@ -70,6 +70,16 @@ namespace PARSER
             /// Invokes the parser.
             void Execute();
 
+            /// Streams the signals of a time-sorted log to the consumer.
+            ///
+            /// The log is parsed twice. The first pass collects the signal
+            /// declarations only. The second pass passes the signals over to
+            /// the consumer without storing them. Instruments are not invoked.
+            ///
+            /// @throws VcdError if the file cannot be rewound.
+            /// @param rConsumer The signals consumer.
+            void Stream(SIGNAL::SignalConsumer &rConsumer);
+
             /// Attaches an instrument to the parser.
             ///
             /// @param rInstrument An instrument to be attached.
@@ -78,6 +88,9 @@ namespace PARSER
             /// Triggers the final instrument actions.
             virtual void TerminateInstruments();
 
+            /// The log parser destructor.
+            virtual ~LogParser() = 0;
+
         protected:
 
             /// The log parser constructor.
@@ -95,12 +108,21 @@ namespace PARSER
                       SIGNAL::SourceRegistry &rSourceRegistry,
                       bool verboseMode);
 
-            /// The log parser destructor.
-            virtual ~LogParser() = 0;
-
             /// Triggers parsing the source.
             virtual void Parse() = 0;
 
+            /// Adds the signals created from one log entry to the database.
+            ///
+            /// The instruments are notified of every signal. The buffer is
+            /// emptied. If a signal cannot be added the remaining signals are
+            /// deleted and the exception is thrown.
+            ///
+            /// @throws VcdError if a signal cannot be added.
+            /// @param rvpSignals The signals of the log entry.
+            /// @param lineNumber The number of the log entry.
+            void AddSignals(std::vector<SIGNAL::Signal *> &rvpSignals,
+                            INSTRUMENT::Instrument::LineNumberT lineNumber);
+
             /// The signal database.
             std::unique_ptr<SIGNAL::SignalDb> m_pSignalDb;
 
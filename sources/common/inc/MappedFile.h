@@ -0,0 +1,78 @@
+/// @file common/inc/MappedFile.h
+///
+/// The read-only memory-mapped file.
+///
+/// @par Full Description
+/// The file contents are accessed in place without being copied.
+///
+/// @ingroup Utils
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace UTILS
+{
+    /// The read-only memory-mapped file class.
+    class MappedFile
+    {
+        public:
+
+            /// The mapped file constructor.
+            ///
+            /// @throws VcdError if the file cannot be mapped.
+            /// @param rFileName The name of the file.
+            MappedFile(const std::string &rFileName);
+
+            /// The mapped file destructor.
+            ~MappedFile();
+
+            /// The mapping cannot be copied.
+            MappedFile(const MappedFile &) = delete;
+
+            /// The mapping cannot be copied.
+            MappedFile &operator=(const MappedFile &) = delete;
+
+            /// Returns the file contents or nullptr if the file is empty.
+            const unsigned char *GetData() const
+            {
+                return m_pData;
+            }
+
+            /// Returns the file size.
+            size_t GetSize() const
+            {
+                return m_Size;
+            }
+
+        private:
+
+            /// The file contents.
+            const unsigned char *m_pData;
+
+            /// The file size.
+            size_t m_Size;
+    };
+
+}
@@ -0,0 +1,164 @@
+/// @file common/inc/NumberConverter.h
+///
+/// The number converter.
+///
+/// @par Full Description
+/// The conversion of decimal, hexadecimal and float strings into numbers.
+/// The errors are reported with status codes rather than exceptions.
+///
+/// @ingroup Utils
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+
+namespace UTILS
+{
+    /// The status of a number conversion.
+    enum class ConversionStatus : uint8_t
+    {
+        /// The number has been converted.
+        OK,
+
+        /// The string does not start with a number.
+        INVALID,
+
+        /// The number does not fit the type.
+        OUT_OF_RANGE
+    };
+
+    /// The number converter class.
+    ///
+    /// The integer conversions follow strtoull(): leading white spaces and
+    /// a sign are accepted and the characters following the number are
+    /// ignored, unless the caller checks the returned end of the number. The long decimal and hexadecimal numbers are converted
+    /// eight digits at a time.
+    class NumberConverter
+    {
+        public:
+
+            /// Converts the decimal string.
+            ///
+            /// @param text The converted string.
+            /// @param rValue The converted value.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertDecimal(std::string_view text, uint64_t &rValue);
+
+            /// Converts the decimal string and returns the end of the number.
+            ///
+            /// @param text The converted string.
+            /// @param rValue The converted value.
+            /// @param rEnd The position following the number.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertDecimal(std::string_view text, uint64_t &rValue, size_t &rEnd);
+
+            /// Converts the hexadecimal string.
+            ///
+            /// The number may be prefixed with '0x' or '0X'.
+            ///
+            /// @param text The converted string.
+            /// @param rValue The converted value.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertHex(std::string_view text, uint64_t &rValue);
+
+            /// Converts the hexadecimal string and returns the end of the number.
+            ///
+            /// @param text The converted string.
+            /// @param rValue The converted value.
+            /// @param rEnd The position following the number.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertHex(std::string_view text, uint64_t &rValue, size_t &rEnd);
+
+            /// Converts the float string.
+            ///
+            /// The conversion follows strtod().
+            ///
+            /// @param text The converted string.
+            /// @param rValue The converted value.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertFloat(std::string_view text, double &rValue);
+
+            /// Converts the float string and returns the end of the number.
+            ///
+            /// @param text The converted string.
+            /// @param rValue The converted value.
+            /// @param rEnd The position following the number.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertFloat(std::string_view text, double &rValue, size_t &rEnd);
+
+            /// Prints the float value.
+            ///
+            /// The printed text converts back to the same value. It is the shortest
+            /// such text if the library can print floats with to_chars().
+            ///
+            /// @param value The printed value.
+            /// @param singlePrecision True if the value is given in the single precision.
+            /// @return The text of the value.
+            static std::string PrintFloat(double value, bool singlePrecision = false);
+
+        private:
+
+            /// The number of digits converted at a time.
+            static const size_t CHUNK_DIGITS = 8;
+
+            /// The largest value which may be followed by eight decimal digits.
+            static const uint64_t MAX_BEFORE_DECIMAL_CHUNK = (std::numeric_limits<uint64_t>::max() - 99999999U) / 100000000U;
+
+            /// Skips the white spaces and the sign.
+            ///
+            /// @param text The converted string.
+            /// @param rNegative Set if the number is negative.
+            /// @return The position of the first character after the sign.
+            static size_t SkipSign(std::string_view text, bool &rNegative);
+
+            /// Returns true if the character is a decimal digit.
+            static bool IsDigit(char character)
+            {
+                return (character >= '0') && (character <= '9');
+            }
+
+            /// Returns the value of the hexadecimal digit or a value above 15.
+            static uint32_t GetHexDigit(char character);
+
+            /// Loads eight characters.
+            ///
+            /// @param text The converted string.
+            /// @param position The position of the first character.
+            static uint64_t LoadChunk(std::string_view text, size_t position);
+
+            /// Returns true if all the eight characters are decimal digits.
+            static bool IsDecimalChunk(uint64_t chunk);
+
+            /// Converts eight decimal digits.
+            static uint64_t ConvertDecimalChunk(uint64_t chunk);
+
+            /// Returns true if all the eight characters are hexadecimal digits.
+            static bool IsHexChunk(uint64_t chunk);
+
+            /// Converts eight hexadecimal digits.
+            static uint64_t ConvertHexChunk(uint64_t chunk);
+    };
+}
@@ -0,0 +1,192 @@
+/// @file common/inc/PcapParser.h
+///
+/// The packet capture log parser.
+///
+/// @par Full Description
+/// The parser creates the signals from the records carried by the UDP
+/// datagrams of the pcap and pcapng captures.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <vector>
+
+#include "LogParser.h"
+#include "BinaryLayout.h"
+
+namespace PARSER
+{
+    /// The packet capture log parser class.
+    ///
+    /// The capture file is memory-mapped. The payload of every UDP datagram
+    /// sent to the given port holds the records described by the binary
+    /// layout. If the records hold no timestamps, the signals are timestamped
+    /// with the capture time of the packets relative to the first packet.
+    ///
+    /// The Ethernet, raw IP, BSD loopback and Linux cooked link layers
+    /// are decoded. The fragmented IPv4 packets and the IPv6 packets with
+    /// the extension headers are skipped.
+    class PcapParser : public LogParser
+    {
+        public:
+
+            /// The packet capture log parser constructor.
+            ///
+            /// @param rFilename The name of the capture file to be open.
+            /// @param rTimeBase The time base used in the log.
+            /// @param rSourceRegistry Signal sources registry.
+            /// @param rLayout The layout of the datagram payloads.
+            /// @param verboseMode Value 'true' enables the verbose mode.
+            PcapParser(const std::string &rFilename,
+                       const std::string &rTimeBase,
+                       SIGNAL::SourceRegistry &rSourceRegistry,
+                       const BinaryLayout &rLayout,
+                       bool verboseMode);
+
+            /// The destructor.
+            ~PcapParser();
+
+        protected:
+
+            /// Parses the input file.
+            virtual void Parse();
+
+        private:
+
+            /// The capture interface.
+            struct Interface
+            {
+                /// The link layer type.
+                uint32_t m_LinkType;
+
+                /// The number of the decimal digits of the timestamp fractions.
+                uint32_t m_Digits;
+            };
+
+            /// Parses the pcap capture.
+            ///
+            /// @throws VcdError if the capture is corrupted.
+            /// @param pData The capture.
+            /// @param size The capture size.
+            void ParsePcap(const unsigned char *pData, size_t size);
+
+            /// Parses the pcapng capture.
+            ///
+            /// @throws VcdError if the capture is corrupted.
+            /// @param pData The capture.
+            /// @param size The capture size.
+            void ParsePcapng(const unsigned char *pData, size_t size);
+
+            /// Parses the options of the pcapng interface description.
+            ///
+            /// @throws VcdError if the timestamp resolution is not supported.
+            /// @param pOptions The options.
+            /// @param size The options size.
+            /// @param bigEndian True if the section is big endian.
+            /// @param rInterface The interface described.
+            void ParseInterfaceOptions(const unsigned char *pOptions,
+                                       size_t size,
+                                       bool bigEndian,
+                                       Interface &rInterface) const;
+
+            /// Parses the captured packet.
+            ///
+            /// @param pPacket The packet.
+            /// @param size The captured packet size.
+            /// @param rInterface The capture interface.
+            /// @param ticks The capture time in the interface resolution.
+            void ParsePacket(const unsigned char *pPacket,
+                             size_t size,
+                             const Interface &rInterface,
+                             uint64_t ticks);
+
+            /// Finds the UDP datagram payload in the packet.
+            ///
+            /// @param pPacket The packet.
+            /// @param size The captured packet size.
+            /// @param linkType The link layer type.
+            /// @param rpPayload The payload.
+            /// @param rPayloadSize The payload size.
+            /// @return False if the packet is not a datagram sent to the port.
+            bool FindPayload(const unsigned char *pPacket,
+                             size_t size,
+                             uint32_t linkType,
+                             const unsigned char *&rpPayload,
+                             size_t &rPayloadSize) const;
+
+            /// Creates the signals of the datagram payload.
+            ///
+            /// @param pPayload The payload.
+            /// @param size The payload size.
+            /// @param packetTime The packet time in the log time base.
+            void CreateSignals(const unsigned char *pPayload,
+                               size_t size,
+                               uint64_t packetTime);
+
+            /// Converts the capture time to the nanoseconds.
+            ///
+            /// @param ticks The capture time in the interface resolution.
+            /// @param digits The number of the decimal digits of the fractions.
+            /// @param rNanoseconds The capture time in nanoseconds.
+            /// @return False if the time cannot be represented.
+            static bool ConvertToNanoseconds(uint64_t ticks, uint32_t digits, uint64_t &rNanoseconds);
+
+            /// Reads the 16-bit number.
+            ///
+            /// @param pData The number.
+            /// @param bigEndian True if the number is big endian.
+            static uint16_t Read16(const unsigned char *pData, bool bigEndian);
+
+            /// Reads the 32-bit number.
+            ///
+            /// @param pData The number.
+            /// @param bigEndian True if the number is big endian.
+            static uint32_t Read32(const unsigned char *pData, bool bigEndian);
+
+            /// The layout of the datagram payloads.
+            const BinaryLayout &m_rLayout;
+
+            /// The number of the decimal digits of the time base.
+            uint32_t m_TimeBaseDigits;
+
+            /// True if the first packet has been captured.
+            bool m_Started;
+
+            /// The capture time of the first packet in nanoseconds.
+            uint64_t m_StartTime;
+
+            /// The buffer of the created signals.
+            std::vector<SIGNAL::Signal *> m_vpSignals;
+
+            /// The number of the decoded records.
+            uint64_t m_Records;
+
+            /// The number of valid records.
+            uint64_t m_ValidRecords;
+
+            /// The number of invalid records.
+            uint64_t m_InvalidRecords;
+    };
+
+}
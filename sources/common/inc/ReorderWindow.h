@@ -0,0 +1,143 @@
+/// @file common/inc/ReorderWindow.h
+///
+/// The reorder window class.
+///
+/// @par Full Description
+/// The object of this class is supposed to be put in front of the tracing
+/// object to restore the time order of nearly sorted signals streams.
+///
+/// @ingroup Tracer
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <queue>
+#include <vector>
+
+#include "SignalDb.h"
+
+namespace TRACER
+{
+    /// The reorder window class.
+    ///
+    /// The streamed signals are buffered in a min-heap ordered by timestamps
+    /// and the order of arrival. A signal is passed over to the next consumer
+    /// once it falls out of the window, i.e. once it is older than the newest
+    /// signal by more than the window time or once there are more buffered
+    /// signals than the window events.
+    class ReorderWindow : public SIGNAL::SignalConsumer
+    {
+        public:
+
+            /// The window types.
+            enum class WindowT
+            {
+                /// The window size is given in the log time units.
+                TIME,
+
+                /// The window size is given in the number of signals.
+                EVENTS
+            };
+
+            /// The reorder window constructor.
+            ///
+            /// @param rConsumer The consumer of the sorted signals.
+            /// @param type The window type.
+            /// @param size The window size.
+            ReorderWindow(SIGNAL::SignalConsumer &rConsumer,
+                          WindowT type,
+                          uint64_t size);
+
+            /// The reorder window destructor.
+            ~ReorderWindow();
+
+            /// The copy constructor is forbidden.
+            ReorderWindow(const ReorderWindow &) = delete;
+
+            /// The copy assignment is forbidden.
+            ReorderWindow &operator=(const ReorderWindow &) = delete;
+
+            /// @copydoc SIGNAL::SignalConsumer::Begin()
+            virtual void Begin();
+
+            /// Adds the signal to the window.
+            ///
+            /// @throws VcdError if the signal precedes a signal already
+            ///                  passed over to the next consumer.
+            /// @param pSignal The signal.
+            virtual void Consume(SIGNAL::Signal *pSignal);
+
+            /// Passes the remaining signals over to the next consumer.
+            virtual void End();
+
+        private:
+
+            /// The buffered signal.
+            struct Entry
+            {
+                /// The signal timestamp.
+                uint64_t m_Timestamp;
+
+                /// The order of arrival.
+                uint64_t m_Sequence;
+
+                /// The signal.
+                SIGNAL::Signal *m_pSignal;
+            };
+
+            /// The entries comparator making the heap a min-heap.
+            struct EntryGtComparator
+            {
+                /// Compares two entries.
+                bool operator()(const Entry &rLhs, const Entry &rRhs) const
+                {
+                    return (rLhs.m_Timestamp > rRhs.m_Timestamp) ||
+                           ((rLhs.m_Timestamp == rRhs.m_Timestamp) && (rLhs.m_Sequence > rRhs.m_Sequence));
+                }
+            };
+
+            /// Passes the oldest signal over to the next consumer.
+            void Emit();
+
+            /// The consumer of the sorted signals.
+            SIGNAL::SignalConsumer &m_rConsumer;
+
+            /// The window type.
+            const WindowT m_Type;
+
+            /// The window size.
+            const uint64_t m_Size;
+
+            /// The buffered signals.
+            std::priority_queue<Entry, std::vector<Entry>, EntryGtComparator> m_Signals;
+
+            /// The arrival counter.
+            uint64_t m_Sequence = 0;
+
+            /// The newest timestamp.
+            uint64_t m_NewestTimestamp = 0;
+
+            /// The timestamp of the last signal passed over.
+            uint64_t m_EmittedTimestamp = 0;
+    };
+}
@@ -38,9 +38,12 @@
 /// The group consists of the base class defining the common behaviours as
 /// well as of the inheriting signal classes specifying concrete signals.
 
+#include <cstdint>
+#include <iosfwd>
+#include <limits>
+#include <map>
 #include <string>
 #include <vector>
-#include <set>
 
 #include "SourceRegistry.h"
 #include "Timestamp.h"
@@ -57,9 +60,15 @@ namespace SIGNAL
             /// A type for splited signal name fields.
             using SignalNameFieldsT = std::vector<std::string>;
 
+            /// A dense signal identifier type.
+            using IdT = uint32_t;
+
             /// Signal name components delimeter.
             static const char SIGNAL_NAME_DELIM = '.';
 
+            /// The identifier of a signal not added to any signal database.
+            static constexpr IdT INVALID_ID = std::numeric_limits<IdT>::max();
+
             /// The signal constructor.
             ///
             /// This constructor shall be used by the iheriting classes.
@@ -116,6 +125,23 @@ namespace SIGNAL
                 m_Name = name;
             }
 
+            /// Returns the signal's identifier.
+            ///
+            /// The identifier is assigned by the signal database. All signals
+            /// of the same name share the same identifier.
+            IdT GetId() const
+            {
+                return m_Id;
+            }
+
+            /// Sets the signal's identifier.
+            ///
+            /// @param id The new signal's identifier.
+            void SetId(IdT id)
+            {
+                m_Id = id;
+            }
+
             /// Returns signal name splited into fields.
             ///
             /// The module, the sub-module and the signal name must
@@ -175,6 +201,23 @@ namespace SIGNAL
             /// The method is used while generating the header of the VCD file.
             virtual std::string Footprint() const = 0;
 
+            /// Writes the signal's value to the stream.
+            ///
+            /// The method is used while spilling signals out of the memory.
+            /// Other properties are restored from the signal footprint.
+            ///
+            /// @param rOut The output stream.
+            virtual void Serialize(std::ostream &rOut) const = 0;
+
+            /// Creates a signal alike with the value read from the stream.
+            ///
+            /// The method is invoked on the signal footprint.
+            ///
+            /// @param rTimestamp The timestamp of the created signal.
+            /// @param rIn The stream written by Serialize().
+            /// @return The created signal.
+            virtual Signal *Deserialize(const TIME::Timestamp &rTimestamp, std::istream &rIn) const = 0;
+
         protected:
 
             /// The signal comparison method.
@@ -201,6 +244,9 @@ namespace SIGNAL
             const SourceRegistry::HandleT m_SourceHandle =
                 SIGNAL::SourceRegistry::BAD_HANDLE;
 
+            /// The signal's identifier.
+            IdT m_Id = INVALID_ID;
+
         private:
 
             /// The overloaded == operator.
@@ -221,7 +267,7 @@ namespace SIGNAL
 
     };
 
-    /// Comparator for multiset.
+    /// Comparator of the signals' timestamps.
     class PtrTimestampLtComparator
     {
         public:
@@ -233,8 +279,7 @@ namespace SIGNAL
     };
 
     /// A type defining a container for pointers to Signal objects.
-    using SignalCollectionT = std::multiset<const Signal *,
-                                            PtrTimestampLtComparator>;
+    using SignalCollectionT = std::vector<const Signal *>;
 
     /// Type used for unique signals map: name => signal pointer.
     using UniqueSignalsCollectionT = std::map<std::string, const Signal *>;
@@ -0,0 +1,68 @@
+/// @file common/inc/SignalConsumer.h
+///
+/// The signal consumer interface.
+///
+/// @ingroup Signal
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include "Signal.h"
+
+namespace SIGNAL
+{
+
+    /// The signal consumer interface.
+    ///
+    /// A consumer receives the signals streamed by the signal database,
+    /// either as they are added or merged from the spilled runs.
+    class SignalConsumer
+    {
+        public:
+
+            /// Signalizes the consumer the beginning of the signals stream.
+            ///
+            /// All the signal declarations are known to the database by then.
+            virtual void Begin()
+            {
+            }
+
+            /// Consumes the signal.
+            ///
+            /// The consumer takes over the ownership of the signal unless
+            /// an exception is thrown.
+            ///
+            /// @param pSignal The signal.
+            virtual void Consume(SIGNAL::Signal *pSignal) = 0;
+
+            /// Signalizes the consumer the end of the signals stream.
+            virtual void End()
+            {
+            }
+
+        protected:
+
+            /// The consumer destructor.
+            virtual ~SignalConsumer() = default;
+    };
+
+}
@@ -30,13 +30,84 @@
 
 #pragma once
 
+#include <memory>
 #include <regex>
+#include <string_view>
+#include <vector>
 
 #include "Signal.h"
+#include "ISignal.h"
 #include "Instrument.h"
+#include "NumberConverter.h"
 
 namespace PARSER
 {
+    /// The receiver of the signals and warnings created from a log line.
+    ///
+    /// Non-fatal problems found in a log line are reported as warnings
+    /// rather than thrown, so that lines raising warnings do not pay
+    /// for the exception unwinding.
+    class CreationSink
+    {
+        public:
+
+            /// A warning raised by a signal creator.
+            struct Warning
+            {
+                /// The ID of the warning.
+                uint32_t m_Id;
+
+                /// The warning message.
+                std::string m_Message;
+            };
+
+            /// The creation sink constructor.
+            ///
+            /// @param rvpSignals The buffer the created signals are appended to.
+            CreationSink(std::vector<SIGNAL::Signal *> &rvpSignals) :
+                m_rvpSignals(rvpSignals),
+                m_Warnings()
+            {
+            }
+
+            /// Adds the created signal.
+            ///
+            /// @param pSignal The created signal.
+            void AddSignal(SIGNAL::Signal *pSignal)
+            {
+                m_rvpSignals.push_back(pSignal);
+            }
+
+            /// Adds the raised warning.
+            ///
+            /// @param id The ID of the warning.
+            /// @param rMessage The warning message.
+            void AddWarning(uint32_t id, const std::string &rMessage)
+            {
+                m_Warnings.push_back(Warning{id, rMessage});
+            }
+
+            /// Returns the raised warnings.
+            const std::vector<Warning> &GetWarnings() const
+            {
+                return m_Warnings;
+            }
+
+            /// Removes the reported warnings.
+            void ClearWarnings()
+            {
+                m_Warnings.clear();
+            }
+
+        private:
+
+            /// The created signals.
+            std::vector<SIGNAL::Signal *> &m_rvpSignals;
+
+            /// The raised warnings.
+            std::vector<Warning> m_Warnings;
+    };
+
     /// The class provides the interface to create the signal object.
 
     /// A base signal creator class.
@@ -47,31 +118,48 @@ namespace PARSER
             /// The signal creator constructor.
             ///
             /// The constructor initializes the regular expression member variable
-            /// which will be matched against the log line.
+            /// which will be matched against the log line. The creators matching
+            /// the same line may share the already compiled regular expression.
+            /// The creators matching the line without the regular expression
+            /// pass the empty one, which is not compiled.
             /// @param rSignalRegEx The regular expression to be matech against the log line.
-            SignalCreator(const std::string &rSignalRegEx) :
-                m_SignalRegEx("^" + rSignalRegEx + "\r?$"),
-                m_RegEx(rSignalRegEx)
+            /// @param pSignalRegEx The already compiled regular expression or nullptr.
+            SignalCreator(const std::string &rSignalRegEx,
+                          const std::shared_ptr<const std::regex> &pSignalRegEx = nullptr) :
+                m_pSignalRegEx(((nullptr != pSignalRegEx) || rSignalRegEx.empty()) ?
+                               pSignalRegEx :
+                               std::make_shared<const std::regex>("^" + rSignalRegEx + "\r?$")),
+                m_RegEx(rSignalRegEx),
+                m_Match()
             {
             }
 
             /// The destructor.
             virtual ~SignalCreator() = 0;
 
-            /// Return the pointer to the newly created object or nullptr.
+            /// Returns the copy of the creator.
+            ///
+            /// The copy shares the compiled regular expression and expressions
+            /// but has its own matching state. Copies may be used concurrently,
+            /// one per thread.
+            virtual std::unique_ptr<SignalCreator> Clone() const = 0;
+
+            /// Creates the signal objects described by the log line.
             ///
-            /// It creates the integer signal object if the log line is valid and returns
-            /// the pointer to the newly created object.
-            /// If the log line is not matching the integer object specification
-            /// then nullptr is returned.
+            /// If the log line is valid the newly created signal objects
+            /// are added to the sink. If the line matches but a signal
+            /// cannot be created, the warning is added instead.
+            /// Only fatal errors are thrown.
             ///
             /// @param rLogLine The log line serving as the creation specification.
             /// @param lineNumber The log line number.
             /// @param sourceHandle Signal source handle.
-            /// @return Signal pointer if the object has been created or nullptr.
-            virtual SIGNAL::Signal *Create(const std::string &rLogLine,
-                                           INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                           SIGNAL::SourceRegistry::HandleT sourceHandle) const = 0;
+            /// @param rSink The receiver of the created signals and warnings.
+            /// @return True if the log line has been matched.
+            virtual bool Create(const std::string &rLogLine,
+                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                CreationSink &rSink) const = 0;
 
             /// Returns the regex.
             const std::string &GetRegEx() const
@@ -81,11 +169,64 @@ namespace PARSER
 
         protected:
 
+            /// Converts the decimal regex group.
+            ///
+            /// @param rMatch The regular expression groups.
+            /// @param index The index of the regex group.
+            /// @param rValue The converted value.
+            /// @return True if the group holds a decimal number within the range.
+            static bool ConvertDecimalGroup(const std::smatch &rMatch, size_t index, uint64_t &rValue)
+            {
+                const std::ssub_match &rGroup = rMatch[index];
+                const std::string_view group = (0 == rGroup.length()) ?
+                                               std::string_view() :
+                                               std::string_view(&*rGroup.first, static_cast<size_t>(rGroup.length()));
+
+                return (UTILS::ConversionStatus::OK == UTILS::NumberConverter::ConvertDecimal(group, rValue));
+            }
+
+            /// Creates the integer signal if the value fits the vector.
+            ///
+            /// A value exceeding the vector size results in the warning.
+            /// Vectors wider than 64 bits are a fatal error and are still thrown
+            /// by the signal constructor.
+            ///
+            /// @param rName The name of the signal.
+            /// @param size The size of the vector.
+            /// @param rTimestamp The timestamp of the signal.
+            /// @param value The value of the signal.
+            /// @param sourceHandle Signal source handle.
+            /// @param rSink The receiver of the created signal or the warning.
+            static void CreateVector(const std::string &rName,
+                                     size_t size,
+                                     const TIME::Timestamp &rTimestamp,
+                                     uint64_t value,
+                                     SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                     CreationSink &rSink)
+            {
+                if (SIGNAL::ISignal::IsValueInRange(value, size))
+                {
+                    rSink.AddSignal(new SIGNAL::ISignal(rName, size, rTimestamp, value, sourceHandle));
+                }
+                else
+                {
+                    rSink.AddWarning(EXCEPTION::Warning::INSUFFICIENT_VECTOR_SIZE,
+                                     EXCEPTION::TooSmallVector::GetMessage(value, size));
+                }
+            }
+
             /// The RegEx matching the signal description.
-            const std::regex m_SignalRegEx;
+            /// It is shared by the copies of the creator. It is nullptr
+            /// if the line is not matched with the regular expression.
+            const std::shared_ptr<const std::regex> m_pSignalRegEx;
 
             /// The original RegEx string.
             const std::string m_RegEx;
+
+            /// The groups of the matched line.
+            /// The storage is reused for every line instead of being
+            /// allocated per match. Each copy of the creator has its own one.
+            mutable std::smatch m_Match;
     };
 
     inline SignalCreator::~SignalCreator() = default;
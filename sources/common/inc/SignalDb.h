@@ -30,7 +30,12 @@
 
 #pragma once
 
+#include <string_view>
+#include <unordered_map>
+
 #include "Signal.h"
+#include "SignalConsumer.h"
+#include "SignalRuns.h"
 
 namespace SIGNAL
 {
@@ -52,25 +57,105 @@ namespace SIGNAL
             ///
             /// This method adds a signal to the signals' container.
             /// IMPORTANT!!! The signals do not have to be ordered (in the terms of time).
-            /// They will be re-ordered automatically when needed.
+            /// They are re-ordered when the database is finalized.
+            ///
+            /// The signal is given the identifier of its name. The identifiers
+            /// are dense and assigned in the order of the first occurrence.
+            ///
+            /// If a consumer is set the signal is passed over to it
+            /// instead of being stored.
+            ///
+            /// If unchanged values are dropped the signal not changing
+            /// the value of its previous occurrence is deleted.
             ///
             /// @throws VcdError if the signal has a wrong source handle.
             /// @throws VcdError if there are conflicting signal names.
+            /// @throws VcdError if unchanged values are dropped and the signal
+            ///                  precedes its previous occurrence.
             /// @param pSignal The signal to be added to the database.
-            void Add(const SIGNAL::Signal *pSignal);
+            void Add(SIGNAL::Signal *pSignal);
+
+            /// Sets the consumer of the added signals.
+            ///
+            /// The signal footprint is still collected by the database.
+            ///
+            /// @param pConsumer The consumer. Null restores storing the signals.
+            void SetConsumer(SignalConsumer *pConsumer)
+            {
+                m_pConsumer = pConsumer;
+            }
+
+            /// Enables dropping the signals which do not change the values.
+            ///
+            /// The occurrences of every signal must be added in the time order.
+            /// The signals of different names may be added in any order.
+            ///
+            /// @param dropUnchanged 'true' to drop the unchanged values.
+            void SetUnchangedDropping(bool dropUnchanged)
+            {
+                m_DropUnchanged = dropUnchanged;
+            }
+
+            /// Checks if the unchanged values are dropped.
+            bool IsDroppingUnchanged() const
+            {
+                return m_DropUnchanged;
+            }
+
+            /// Sets the maximum number of signals kept in memory.
+            ///
+            /// Once the number is reached the stored signals are spilled
+            /// to a temporary file as a time-sorted run.
+            ///
+            /// @param maxSignals The number of signals. 0 stands for no limit.
+            void SetMemoryBudget(size_t maxSignals)
+            {
+                m_MemoryBudget = maxSignals;
+            }
+
+            /// Orders the stored signals by timestamps.
+            ///
+            /// The signals are sorted with all the hardware threads.
+            /// The signals of equal timestamps keep the order in which
+            /// they have been added, i.e. the order of the log lines and
+            /// of the signals within a line. Shall be called once all
+            /// the signals have been added and before they are read.
+            void Finalize();
 
             /// Returns a reference to the signals collection.
+            ///
+            /// Only the signals kept in memory are returned.
+            /// The signals are time-ordered once the database is finalized.
             const SIGNAL::SignalCollectionT &GetSignals() const
             {
-                return m_SignalSet;
+                return m_Signals;
             }
 
-            /// Returns a reference to the database signal footprint.
-            const SIGNAL::UniqueSignalsCollectionT &GetSignalFootprint() const
+            /// Checks if any signals have been spilled out of the memory.
+            bool HasSpilledSignals() const
             {
-                return m_AddedSignals;
+                return (0 != m_Runs.GetCount());
             }
 
+            /// Passes over all the stored signals to the consumer in the time order.
+            ///
+            /// The spilled runs and the signals kept in memory are merged.
+            /// The database shall be finalized beforehand.
+            /// The consumer is given new signals, the stored ones remain intact.
+            ///
+            /// @throws VcdError if a spilled run cannot be read.
+            /// @param rConsumer The signals consumer.
+            void Replay(SignalConsumer &rConsumer) const
+            {
+                m_Runs.Merge(m_Prototypes, m_Signals, rConsumer);
+            }
+
+            /// Returns a reference to the database signal footprint.
+            ///
+            /// The footprint is ordered by names. It is built on demand
+            /// and extended with the signals added since the last call.
+            const SIGNAL::UniqueSignalsCollectionT &GetSignalFootprint() const;
+
             /// Returns a time unit used in the database.
             std::string GetTimeUnit() const
             {
@@ -78,14 +163,59 @@ namespace SIGNAL
             }
 
         private:
+
+            /// Checks if the signal changes the value of its previous occurrence.
+            ///
+            /// The last values of the signals are updated.
+            ///
+            /// @throws VcdError if the signal precedes its previous occurrence.
+            /// @param pSignal The signal.
+            /// @return 'true' if the value has changed.
+            bool IsValueChanged(const SIGNAL::Signal *pSignal);
+
+            /// Spills the stored signals to a new run.
+            void Spill();
+
             /// The VCD time unit in which the signals are timestamped.
             const std::string m_TimeUnit;
 
-            /// The unique signals collection.
-            SIGNAL::UniqueSignalsCollectionT m_AddedSignals;
+            /// The identifiers of the unique signals indexed by names.
+            ///
+            /// The names are views of the names of the unique signals.
+            std::unordered_map<std::string_view, SIGNAL::Signal::IdT> m_SignalIds;
+
+            /// The unique signals indexed by identifiers.
+            ///
+            /// It owns copies of the first occurrences of the signals.
+            SIGNAL::SignalRuns::PrototypesT m_Prototypes;
+
+            /// The unique signals ordered by names.
+            mutable SIGNAL::UniqueSignalsCollectionT m_Footprint;
 
             /// The container for the signals.
-            SIGNAL::SignalCollectionT m_SignalSet;
+            ///
+            /// The signals are kept in the order of addition until finalized.
+            SIGNAL::SignalCollectionT m_Signals;
+
+            /// Tells if the stored signals are ordered by timestamps.
+            bool m_Sorted = true;
+
+            /// The consumer of the added signals.
+            SignalConsumer *m_pConsumer = nullptr;
+
+            /// The maximum number of signals kept in memory.
+            size_t m_MemoryBudget = 0;
+
+            /// Tells if the unchanged values are dropped.
+            bool m_DropUnchanged = false;
+
+            /// The last values of the signals indexed by identifiers.
+            ///
+            /// They own copies of the signals timestamped with the last occurrences.
+            std::vector<SIGNAL::Signal *> m_LastValues;
+
+            /// The signals spilled out of the memory.
+            SIGNAL::SignalRuns m_Runs;
     };
 
 }
@@ -44,27 +44,85 @@ namespace PARSER
         public:
 
             /// The signal factory default constructor.
-            SignalFactory();
+            ///
+            /// @param exclusive True if a log line may be matched by one creator only.
+            SignalFactory(bool exclusive = false);
+
+            /// The destructor.
+            virtual ~SignalFactory() = default;
 
             /// Creates the appropriate signal objects.
             ///
-            /// Returns the pointer to the list of created signal objects.
-            /// If emtpy no signal could be created.
+            /// The created signal objects are appended to the buffer owned
+            /// by the caller. The buffer is meant to be reused for all the
+            /// lines of the log, so that no memory is allocated per line.
+            ///
+            /// All the creators are tried in the order they have been added,
+            /// unless the creators are exclusive. Then the creators are tried
+            /// in the order of their observed hit frequency and the matching
+            /// stops at the first one matching the line.
             ///
             /// @param logLine One line from the log.
             /// @param lineNumber The log line number.
             /// @param sourceHandle Signal source handle.
-            std::vector<const SIGNAL::Signal*> Create(std::string &logLine,
-                                                      INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                                      SIGNAL::SourceRegistry::HandleT sourceHandle) const;
+            /// @param rvpSignals The buffer of the created signals.
+            /// @return The number of the created signals. If zero no signal could be created.
+            size_t Create(std::string &logLine,
+                          INSTRUMENT::Instrument::LineNumberT lineNumber,
+                          SIGNAL::SourceRegistry::HandleT sourceHandle,
+                          std::vector<SIGNAL::Signal *> &rvpSignals) const;
+
+            /// Returns the copy of the factory.
+            ///
+            /// The factory is not thread-safe as the creators keep the state
+            /// of the matched line. The copy shares the compiled regular
+            /// expressions and expressions with the original and is meant
+            /// to be used by another thread. The hit statistics of the
+            /// exclusive creators are copied.
+            ///
+            /// @return The factory copy.
+            std::unique_ptr<SignalFactory> Clone() const;
+
+            /// Returns true if a log line may be matched by one creator only.
+            bool IsExclusive() const
+            {
+                return m_Exclusive;
+            }
 
         protected:
 
             /// The table of pointers to signal creators.
             std::vector<std::unique_ptr<SignalCreator>> m_vpSignalCreators;
 
+            /// Set if the creators match mutually exclusive log lines.
+            bool m_Exclusive;
+
         private:
 
+            /// Creates the signals using one creator.
+            ///
+            /// The warnings raised by the creator are logged.
+            ///
+            /// @param rCreator The signal creator.
+            /// @param logLine The log line.
+            /// @param lineNumber The log line number.
+            /// @param sourceHandle Signal source handle.
+            /// @param rSink The receiver of the created signals.
+            /// @return True if the creator has matched the line.
+            bool CreateSignals(const SignalCreator &rCreator,
+                               const std::string &logLine,
+                               INSTRUMENT::Instrument::LineNumberT lineNumber,
+                               SIGNAL::SourceRegistry::HandleT sourceHandle,
+                               CreationSink &rSink) const;
+
+            /// Counts the hit of the exclusive creator.
+            ///
+            /// The creator is moved ahead of the creators having fewer hits.
+            /// The creators with the same number of hits keep their order.
+            ///
+            /// @param position The position of the creator in the matching order.
+            void CountHit(size_t position) const;
+
             /// Returns log line details.
             ///
             /// Returns the string containing the log line information.
@@ -74,6 +132,12 @@ namespace PARSER
             std::string GetLogLineInfo(SIGNAL::SourceRegistry::HandleT sourceHandle,
                                        size_t lineNumber,
                                        const std::string &logLine) const;
+
+            /// The indexes of the exclusive creators in the matching order.
+            mutable std::vector<size_t> m_CreatorOrder;
+
+            /// The number of lines matched by each of the exclusive creators.
+            mutable std::vector<uint64_t> m_CreatorHits;
     };
 
 }
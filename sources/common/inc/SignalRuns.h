@@ -0,0 +1,142 @@
+/// @file common/inc/SignalRuns.h
+///
+/// The spilled signal runs class.
+///
+/// @par Full Description
+/// The object of this class is supposed to be used by the signal database
+/// to keep time-sorted runs of signals in temporary files.
+///
+/// @ingroup Signal
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Signal.h"
+#include "SignalConsumer.h"
+
+namespace SIGNAL
+{
+
+    /// The spilled signal runs class.
+    ///
+    /// Every run is a temporary file of compact signal records sorted by
+    /// timestamps. A record consists of the timestamp, the signal
+    /// identifier and the serialized value. The other signal properties
+    /// are restored from the signal footprint. The runs are kept in
+    /// a private directory, created exclusively in the temporary
+    /// directory with the first run.
+    class SignalRuns
+    {
+        public:
+
+            /// A type of the signal footprints indexed by identifiers.
+            using PrototypesT = std::vector<const Signal *>;
+
+            /// The signal runs constructor.
+            SignalRuns();
+
+            /// The destructor removes the temporary files and their directory.
+            ~SignalRuns();
+
+            /// The copy constructor is forbidden.
+            SignalRuns(const SignalRuns &) = delete;
+
+            /// The copy assignment is forbidden.
+            SignalRuns &operator=(const SignalRuns &) = delete;
+
+            /// Writes the signals to a new run.
+            ///
+            /// @throws VcdError if the temporary file cannot be written.
+            /// @param rSignals The time-sorted signals.
+            void Spill(const SignalCollectionT &rSignals);
+
+            /// Returns the number of runs.
+            size_t GetCount() const
+            {
+                return m_Files.size();
+            }
+
+            /// Returns the directory of the runs.
+            ///
+            /// The directory is empty until the first run is spilled.
+            const std::string &GetDirectory() const
+            {
+                return m_Directory;
+            }
+
+            /// Merges the runs and the signals kept in memory.
+            ///
+            /// The signals are passed over to the consumer in the time order.
+            /// Signals of the same timestamp are passed in the order they
+            /// were added, hence the signals kept in memory go last.
+            ///
+            /// @throws VcdError if a run cannot be read.
+            /// @param rPrototypes The signal footprints indexed by identifiers.
+            /// @param rSignals The time-sorted signals kept in memory.
+            /// @param rConsumer The consumer of the merged signals.
+            void Merge(const PrototypesT &rPrototypes,
+                       const SignalCollectionT &rSignals,
+                       SignalConsumer &rConsumer) const;
+
+        private:
+
+            /// Writes the value in the native representation.
+            ///
+            /// @param rOut The output stream.
+            /// @param value The value.
+            template<class T> static void Write(std::ostream &rOut, T value)
+            {
+                rOut.write(reinterpret_cast<const char *>(&value), sizeof(value));
+            }
+
+            /// Reads the value written by Write().
+            ///
+            /// @param rIn The input stream.
+            /// @param rValue The read value.
+            /// @return 'true' if the value has been read.
+            template<class T> static bool Read(std::istream &rIn, T &rValue)
+            {
+                return static_cast<bool>(rIn.read(reinterpret_cast<char *>(&rValue), sizeof(rValue)));
+            }
+
+            /// Creates the private directory of the runs.
+            ///
+            /// @throws VcdError if the directory cannot be created.
+            void CreateRunDirectory();
+
+            /// Creates the name of a new temporary file.
+            std::string CreateFileName() const;
+
+            /// The private directory of the runs.
+            std::string m_Directory;
+
+            /// The temporary files.
+            std::vector<std::string> m_Files;
+    };
+
+}
@@ -0,0 +1,149 @@
+/// @file common/inc/SignalSorter.h
+///
+/// The signal sorter class.
+///
+/// @par Full Description
+/// The signals are ordered by timestamps. The signals of equal timestamps
+/// keep their insertion order, i.e. the order of log lines and of the signals
+/// within a line.
+///
+/// The signals are split into partitions sorted concurrently with the LSD
+/// radix sort. The sorted partitions are then merged pairwise, each merge
+/// split into independent segments with the merge path algorithm.
+///
+/// @ingroup Signal
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include "Signal.h"
+
+namespace SIGNAL
+{
+
+    /// The class sorting signals by timestamps.
+    class SignalSorter
+    {
+        public:
+
+            /// The default minimum number of signals sorted by one thread.
+            static const size_t DEFAULT_MIN_PARTITION_SIZE = (1U << 16);
+
+            /// The signal sorter constructor.
+            ///
+            /// @param threads The maximum number of sorting threads.
+            ///                0 stands for the number of hardware threads.
+            /// @param minPartitionSize The minimum number of signals sorted by one thread.
+            SignalSorter(size_t threads = 0,
+                         size_t minPartitionSize = DEFAULT_MIN_PARTITION_SIZE);
+
+            /// Sorts the signals by timestamps.
+            ///
+            /// The sort is stable.
+            ///
+            /// @param rSignals The signals to be sorted.
+            void Sort(SignalCollectionT &rSignals) const;
+
+        private:
+
+            /// The sorted record.
+            ///
+            /// The timestamp is kept next to the signal not to dereference
+            /// the signal whenever it is compared.
+            struct Record
+            {
+                /// The timestamp value.
+                uint64_t m_Timestamp;
+
+                /// The signal.
+                const Signal *m_pSignal;
+            };
+
+            /// Sorts the records with the LSD radix sort.
+            ///
+            /// The bytes of the timestamps which are equal for all the records
+            /// are skipped.
+            ///
+            /// @param pRecords The records to be sorted.
+            /// @param pBuffer The buffer of the same size as the records.
+            /// @param count The number of records.
+            static void RadixSort(Record *pRecords, Record *pBuffer, size_t count);
+
+            /// Finds where the merge path crosses the diagonal.
+            ///
+            /// @param pLeft The left sorted records.
+            /// @param leftCount The number of the left records.
+            /// @param pRight The right sorted records.
+            /// @param rightCount The number of the right records.
+            /// @param diagonal The number of the merged records preceding the diagonal.
+            /// @return The number of the left records preceding the diagonal.
+            static size_t FindSplit(const Record *pLeft,
+                                    size_t leftCount,
+                                    const Record *pRight,
+                                    size_t rightCount,
+                                    size_t diagonal);
+
+            /// Merges the segment of two sorted runs.
+            ///
+            /// The left records precede the right ones of equal timestamps.
+            ///
+            /// @param pLeft The left sorted records.
+            /// @param leftCount The number of the left records.
+            /// @param pRight The right sorted records.
+            /// @param rightCount The number of the right records.
+            /// @param pOutput The merged records.
+            /// @param begin The first merged record of the segment.
+            /// @param end The merged record following the segment.
+            static void MergeSegment(const Record *pLeft,
+                                     size_t leftCount,
+                                     const Record *pRight,
+                                     size_t rightCount,
+                                     Record *pOutput,
+                                     size_t begin,
+                                     size_t end);
+
+            /// Runs the task in a new worker thread.
+            ///
+            /// The task is run in the calling thread if no thread can be created.
+            ///
+            /// @param rWorkers The worker threads.
+            /// @param rTask The task.
+            static void Spawn(std::vector<std::thread> &rWorkers, const std::function<void()> &rTask);
+
+            /// Waits for the worker threads to finish.
+            ///
+            /// @param rWorkers The worker threads.
+            static void Join(std::vector<std::thread> &rWorkers);
+
+            /// The maximum number of sorting threads.
+            size_t m_Threads;
+
+            /// The minimum number of signals sorted by one thread.
+            size_t m_MinPartitionSize;
+    };
+
+}
@@ -26,14 +26,21 @@
 
 #pragma once
 
+#include <cstddef>
+#include <limits>
 #include <ostream>
-#include <tuple>
+#include <string_view>
+#include <vector>
 
 #include "Signal.h"
 
 namespace TRACER
 {
     /// VCD signal structure builder.
+    ///
+    /// The scope hierarchy is built once as a trie of signal name fields.
+    /// The fields are views into the names of the unique signals, hence no
+    /// strings are copied. The structure is then dumped in a single traversal.
     class SignalStructureBuilder
     {
         public:
@@ -54,44 +61,79 @@ namespace TRACER
 
         private:
 
-            /// Dump generated line to assigned stream with indent.
-            void DumpIndented(const std::string &value, std::size_t indentLevel)
+            /// The trie node index type.
+            using NodeIndexT = std::size_t;
+
+            /// The trie node.
+            struct Node
             {
-                m_Output << std::string(indentLevel, '\t') << value << '\n';
-            }
+                /// The name field.
+                std::string_view m_Name;
+
+                /// The signal of a variable node. Null for a scope.
+                const SIGNAL::Signal *m_pSignal;
+
+                /// The first child.
+                NodeIndexT m_FirstChild;
+
+                /// The last child.
+                NodeIndexT m_LastChild;
+
+                /// The next sibling.
+                NodeIndexT m_NextSibling;
+            };
+
+            /// Marks a missing node.
+            static constexpr NodeIndexT NO_NODE = std::numeric_limits<NodeIndexT>::max();
+
+            /// The root scope index.
+            static constexpr NodeIndexT ROOT_NODE = 0;
 
-            /// Checks if scopes should be ended or continued.
+            /// Builds the trie of all unique signals.
+            void BuildTrie();
+
+            /// Inserts the signal into the trie.
+            ///
+            /// Signals are inserted in the order of their names. All the
+            /// signals of a scope are thus inserted one after another and only
+            /// the last child of a node has to be checked for continuation.
             ///
-            /// If no mismatch was found current scope should be continued from
-            /// returned index. If mismatch was found, scopes should be ended
-            /// down to returned index and new should be started from it.
-            /// @param currentFields Fields from current iteration.
-            /// @param previousFields Fields from previous iteration.
-            /// @return Continuation index.
-            std::tuple<bool, std::size_t> FindContinuation(const SIGNAL::Signal::SignalNameFieldsT &currentFields,
-                                                           const SIGNAL::Signal::SignalNameFieldsT &previousFields);
-
-            /// Ends scopes from the end of fields to lowerLimit.
+            /// @param pSignal The signal to be inserted.
+            void Insert(const SIGNAL::Signal *pSignal);
+
+            /// Appends a new child node.
             ///
-            /// If lowerLimit is 0 all scopes are ended.
-            void EndScopesDownTo(const SIGNAL::Signal::SignalNameFieldsT &fields,
-                                 std::size_t lowerLimit);
+            /// @param parent The parent node.
+            /// @param name The name field.
+            /// @param pSignal The signal. Null for a scope.
+            /// @return The index of the new node.
+            NodeIndexT AppendChild(NodeIndexT parent,
+                                   std::string_view name,
+                                   const SIGNAL::Signal *pSignal);
 
-            /// Continues current scope (possibly after mismatch)
+            /// Dumps children of the node.
             ///
-            /// @param continueFrom Continuation index obtained from FindContinuation.
-            /// @param fields Fields from current iteration.
-            /// @param signal Signal in current iteration.
-            void ContinueScopes(std::size_t continueFrom,
-                                const SIGNAL::Signal::SignalNameFieldsT &fields,
-                                const SIGNAL::Signal *signal);
+            /// @param parent The parent node.
+            /// @param indentLevel The indentation of children.
+            void DumpChildren(NodeIndexT parent, std::size_t indentLevel);
+
+            /// Dumps indentation to assigned stream.
+            void DumpIndent(std::size_t indentLevel)
+            {
+                for (std::size_t i = 0; i < indentLevel; ++i)
+                {
+                    m_Output.put('\t');
+                }
+            }
 
             /// Unique signals map.
-            const SIGNAL::UniqueSignalsCollectionT m_UniqueSignals;
+            const SIGNAL::UniqueSignalsCollectionT &m_UniqueSignals;
 
             /// Assigned output stream.
             std::ostream &m_Output;
+
+            /// The trie nodes. The root scope goes first.
+            std::vector<Node> m_Nodes;
     };
 
 }
-
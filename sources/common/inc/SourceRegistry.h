@@ -6,6 +6,9 @@
 /// The object of this class will keep a track of the registered source
 /// signals. It allows for detecting their duplicated names.
 ///
+/// The sources may be registered and looked up by concurrent threads.
+/// The names are found by handles without locking.
+///
 /// @ingroup Signal
 ///
 /// @par Copyright (c) 2017 vcdMaker team
@@ -30,8 +33,12 @@
 
 #pragma once
 
-#include <map>
+#include <array>
+#include <atomic>
 #include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 
 namespace SIGNAL
 {
@@ -53,6 +60,9 @@ namespace SIGNAL
                 return instance;
             }
 
+            /// The destructor.
+            ~SourceRegistry();
+
             /// Registers a signal source.
             ///
             /// @param rSourceName The name of the signal source.
@@ -64,20 +74,42 @@ namespace SIGNAL
 
             /// Returns the name of the signal source.
             ///
+            /// The name is found in constant time without locking.
+            ///
             /// @throws VcdError if cannot find the source name.
             /// @param sourceHandle The source handle.
-            std::string GetSourceName(HandleT sourceHandle) const;
+            const std::string &GetSourceName(HandleT sourceHandle) const;
 
         private:
             /// The default constructor.
             SourceRegistry();
 
             /// A registry type.
-            using RegistryT = std::map<std::string, HandleT>;
+            using RegistryT = std::unordered_map<std::string, HandleT>;
+
+            /// The number of names in the first segment.
+            ///
+            /// Every next segment is twice as large as the previous one.
+            static const size_t FIRST_SEGMENT_SIZE = 16;
+
+            /// The number of segments. Enough for all the handles.
+            static const size_t SEGMENTS = std::numeric_limits<HandleT>::digits;
 
             /// The sources registry.
             RegistryT m_Registry;
 
+            /// The registration lock.
+            std::mutex m_RegistryMutex;
+
+            /// The segments of the source names indexed by handles.
+            ///
+            /// The segments are never moved, so the names can be read
+            /// while new ones are registered.
+            std::array<std::atomic<std::string *>, SEGMENTS> m_Names;
+
+            /// The number of the registered sources.
+            std::atomic<size_t> m_Count;
+
             /// The next available registry handle.
             HandleT m_NextSourceHandle =
                 std::numeric_limits<HandleT>::max();
@@ -95,6 +127,18 @@ namespace SIGNAL
             ///
             /// @throws VcdError if no handles available.
             HandleT GetNewHandle();
+
+            /// Returns the index of the source of the given handle.
+            static size_t GetIndex(HandleT sourceHandle)
+            {
+                return (std::numeric_limits<HandleT>::max() - sourceHandle);
+            }
+
+            /// Returns the segment of the source name.
+            ///
+            /// @param index The index of the source.
+            /// @param rOffset The offset of the name within the segment.
+            /// @return The segment index.
+            static size_t GetSegment(size_t index, size_t &rOffset);
     };
-    inline SourceRegistry::SourceRegistry() = default;
 }
@@ -30,27 +30,42 @@
 
 #pragma once
 
-#include <fstream>
+#include <ostream>
+#include <vector>
 
 #include "Signal.h"
 
 namespace TRACER
 {
     /// The time frame class.
+    ///
+    /// The last values and the signals changed within the current frame
+    /// are indexed by the position of the signal name in the name order
+    /// of the database footprint. It keeps the output of a frame sorted
+    /// by names without any string comparisons on the per-signal path.
     class TimeFrame
     {
         public:
             /// The time frame constructor.
             ///
             /// @param rTimestamp The initial timestamp.
+            /// @param rSignals The unique signals of the traced database.
             /// @param rFile The output stream.
-            TimeFrame(const TIME::Timestamp &rTimestamp, std::ofstream &rFile) :
-                m_Timestamp(rTimestamp),
-                m_rFile(rFile),
-                m_FrameSignals(),
-                m_Signals()
-            {
-            }
+            /// @param ownsSignals Value 'true' makes the frame take over
+            ///                    the ownership of the added signals.
+            TimeFrame(const TIME::Timestamp &rTimestamp,
+                      const SIGNAL::UniqueSignalsCollectionT &rSignals,
+                      std::ostream &rFile,
+                      bool ownsSignals = false);
+
+            /// The time frame destructor.
+            ~TimeFrame();
+
+            /// The copy constructor is forbidden.
+            TimeFrame(const TimeFrame &) = delete;
+
+            /// The copy assignment is forbidden.
+            TimeFrame &operator=(const TimeFrame &) = delete;
 
             /// Sets the beginning of the frame.
             ///
@@ -62,6 +77,9 @@ namespace TRACER
 
             /// Adds the signal information to the time frame.
             ///
+            /// The signal must belong to the database the frame was created for.
+            /// An owning frame keeps only the last value of every signal.
+            ///
             /// @param pSignal The signal.
             void Add(const SIGNAL::Signal *pSignal);
 
@@ -72,6 +90,9 @@ namespace TRACER
 
         private:
 
+            /// A type of the frame generation counter.
+            using GenerationT = uint64_t;
+
             /// Write on line to output file.
             void DumpLine(const std::string &rLine)
             {
@@ -80,21 +101,34 @@ namespace TRACER
 
             /// Check weather given signal value has been already added.
             ///
+            /// @param index The signal index.
             /// @param pSignal The signal.
             /// @retval true Signal with this value has been already added.
             /// @retval false Signal with this value has not been added.
-            bool WasSignalValueAdded(const SIGNAL::Signal *pSignal);
+            bool WasSignalValueAdded(size_t index, const SIGNAL::Signal *pSignal) const;
 
             /// The timestamp of the time frame.
             TIME::Timestamp m_Timestamp;
 
             /// The output stream.
-            std::ofstream &m_rFile;
+            std::ostream &m_rFile;
+
+            /// Signal indexes sorted by names. Indexed by signal identifiers.
+            std::vector<size_t> m_Indexes;
+
+            /// The last values of all signals.
+            std::vector<const SIGNAL::Signal *> m_Signals;
+
+            /// The frame generations in which the signals were last changed.
+            std::vector<GenerationT> m_SignalGenerations;
+
+            /// Indexes of the signals changed within the time frame.
+            std::vector<size_t> m_FrameSignals;
 
-            /// Time frame signals.
-            SIGNAL::UniqueSignalsCollectionT m_FrameSignals;
+            /// The current frame generation.
+            GenerationT m_Generation = 1;
 
-            /// All signals.
-            SIGNAL::UniqueSignalsCollectionT m_Signals;
+            /// The ownership of the added signals.
+            const bool m_OwnsSignals;
     };
 }
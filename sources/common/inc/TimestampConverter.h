@@ -0,0 +1,140 @@
+/// @file common/inc/TimestampConverter.h
+///
+/// The timestamp converter.
+///
+/// @par Full Description
+/// The converter parses the fixed-format timestamps directly into the log time base.
+///
+/// @ingroup Utils
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "NumberConverter.h"
+
+namespace UTILS
+{
+    /// The timestamp converter class.
+    ///
+    /// The timestamps are converted to the log time base given by the time
+    /// unit index. The fraction digits below the time base are truncated.
+    /// The timestamp may be surrounded by white spaces only, any other
+    /// trailing characters make it invalid.
+    class TimestampConverter
+    {
+        public:
+
+            /// Converts the time of day, e.g. '12:03:44.123456'.
+            ///
+            /// The hours are given by one or two digits, the minutes and
+            /// the seconds by two digits. The fraction of the second is optional.
+            ///
+            /// @param text The converted string.
+            /// @param timeBase The time unit index of the log time base.
+            /// @param rValue The number of the time base units since midnight.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertTimeOfDay(std::string_view text, size_t timeBase, uint64_t &rValue);
+
+            /// Converts the seconds since the epoch, e.g. '1712345678.000123'.
+            ///
+            /// The fraction of the second is optional.
+            ///
+            /// @param text The converted string.
+            /// @param timeBase The time unit index of the log time base.
+            /// @param rValue The number of the time base units since the epoch.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertEpoch(std::string_view text, size_t timeBase, uint64_t &rValue);
+
+            /// Converts the decimal number of the time units, e.g. '2.5 ms'.
+            ///
+            /// The number may be followed by the time unit, optionally
+            /// separated with white spaces. Otherwise the given unit is used.
+            /// Any other suffix makes the number invalid.
+            ///
+            /// @param text The converted string.
+            /// @param unit The time unit index of the number without the unit.
+            /// @param timeBase The time unit index of the log time base.
+            /// @param rValue The number of the time base units.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertDecimal(std::string_view text, size_t unit, size_t timeBase, uint64_t &rValue);
+
+        private:
+
+            /// Skips the white spaces.
+            ///
+            /// @param text The converted string.
+            /// @param position The position of the first character checked.
+            /// @return The position of the first character following the white spaces.
+            static size_t SkipSpaces(std::string_view text, size_t position);
+
+            /// Converts the decimal digits.
+            ///
+            /// @param text The converted string.
+            /// @param rPosition The position of the first digit, moved past the last one.
+            /// @param maxDigits The maximum number of the digits converted.
+            /// @param rValue The converted value.
+            /// @return The status of the conversion.
+            static ConversionStatus ConvertDigits(std::string_view text,
+                                                  size_t &rPosition,
+                                                  size_t maxDigits,
+                                                  uint64_t &rValue);
+
+            /// Scales the number and adds its fraction.
+            ///
+            /// @param text The converted string.
+            /// @param rPosition The position following the integer part, moved past the fraction.
+            /// @param integer The integer part of the number.
+            /// @param exponent The power of ten the number is multiplied by.
+            /// @param rValue The scaled value.
+            /// @return The status of the conversion.
+            static ConversionStatus Scale(std::string_view text,
+                                          size_t &rPosition,
+                                          uint64_t integer,
+                                          int exponent,
+                                          uint64_t &rValue);
+
+            /// Returns the index of the time unit at the position or
+            /// the number of the time units if there is no unit.
+            ///
+            /// @param text The converted string.
+            /// @param position The position of the unit.
+            static size_t FindUnit(std::string_view text, size_t position);
+
+            /// Returns true if only white spaces follow the position.
+            ///
+            /// @param text The converted string.
+            /// @param position The position of the first character checked.
+            static bool IsEnd(std::string_view text, size_t position)
+            {
+                return (SkipSpaces(text, position) == text.size());
+            }
+
+            /// Returns true if the character is a decimal digit.
+            static bool IsDigit(char character)
+            {
+                return (character >= '0') && (character <= '9');
+            }
+    };
+}
@@ -48,4 +48,15 @@ namespace UTILS
     /// @param delimiter The delimiter.
     std::vector<std::string> Split(const std::string &rInString,
                                    const char delimiter);
+
+    /// Converts the description of the fields delimiter.
+    ///
+    /// The delimiter is a single character. The tab may be given as '\\t'
+    /// as the whitespaces of the XML attributes are normalized.
+    ///
+    /// @param rDescription The delimiter description.
+    /// @param rDelimiter The delimiter.
+    /// @return False if the description is invalid.
+    bool ConvertDelimiter(const std::string &rDescription,
+                          char &rDelimiter);
 }
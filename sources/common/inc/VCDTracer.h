@@ -37,8 +37,10 @@
 /// The Tracer subsystem is responsible for tracing output files.
 
 #include <fstream>
+#include <memory>
 
 #include "SignalDb.h"
+#include "TimeFrame.h"
 
 /// VCD tracer.
 namespace TRACER
@@ -46,7 +48,10 @@ namespace TRACER
     /// The VCD file creator.
     /// The class provides means for creating
     /// the output VCD file.
-    class VCDTracer
+    ///
+    /// The file is created either at once from the whole signals database
+    /// or by consuming the time-sorted signals streamed by a parser.
+    class VCDTracer : public SIGNAL::SignalConsumer
     {
         public:
 
@@ -54,14 +59,29 @@ namespace TRACER
             ///
             /// @param outputFile Name of the output VCD file.
             /// @param signalDb Signals database to be traced to the output file.
-            VCDTracer(const std::string &outputFile, const SIGNAL::SignalDb &signalDb);
+            VCDTracer(const std::string &outputFile, SIGNAL::SignalDb &signalDb);
 
             /// Creates the output VCD file.
             ///
             /// Function creates the header of the VCF file as well as the body
-            /// listing all signal changes.
+            /// listing all signal changes. The signals database is finalized
+            /// beforehand.
             void Dump();
 
+            /// Starts tracing the signals stream.
+            ///
+            /// The header of the VCD file is created.
+            virtual void Begin();
+
+            /// Traces the signal from the stream.
+            ///
+            /// @throws VcdError if the signal precedes the last traced signal.
+            /// @param pSignal The signal.
+            virtual void Consume(SIGNAL::Signal *pSignal);
+
+            /// Finishes tracing the signals stream.
+            virtual void End();
+
         private:
 
             /// Generates the VCD header.
@@ -85,9 +105,13 @@ namespace TRACER
 
             /// Generates the VCD body.
             ///
-            /// Dumps time-ordered signal value changes.
+            /// Dumps time-ordered signal value changes. If the database has
+            /// spilled signals, the k-way merge of the runs is traced.
             void GenerateBody();
 
+            /// Starts the time frame of the signals stream.
+            void StartStream();
+
             /// Write on line to output file.
             void DumpLine(const std::string &line)
             {
@@ -103,6 +127,12 @@ namespace TRACER
             std::ofstream m_File;
 
             /// The signals database.
-            const SIGNAL::SignalDb &m_rSignalDb;
+            SIGNAL::SignalDb &m_rSignalDb;
+
+            /// The time frame of the signals stream.
+            std::unique_ptr<TimeFrame> m_pStreamFrame;
+
+            /// The timestamp of the last streamed signal.
+            TIME::Timestamp m_StreamTimestamp;
     };
 }
@@ -100,11 +100,20 @@ namespace EXCEPTION
             /// @param value The value of the signal.
             /// @param size The size of the vector to hold the value.
             TooSmallVector(uint64_t value, uint64_t size)
-                : std::runtime_error("Value " +
-                                     std::to_string(value) +
-                                     " exceeds the " +
-                                     std::to_string(size) +
-                                     "-bit size of the vector. Dropping the signal.")
+                : std::runtime_error(GetMessage(value, size))
             {}
+
+            /// Returns the warning message.
+            ///
+            /// @param value The value of the signal.
+            /// @param size The size of the vector to hold the value.
+            static std::string GetMessage(uint64_t value, uint64_t size)
+            {
+                return "Value " +
+                       std::to_string(value) +
+                       " exceeds the " +
+                       std::to_string(size) +
+                       "-bit size of the vector. Dropping the signal.";
+            }
     };
 }
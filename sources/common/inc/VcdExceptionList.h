@@ -52,6 +52,9 @@ namespace EXCEPTION
 
         /// Insufficient vector size.
         const uint32_t INSUFFICIENT_VECTOR_SIZE = 3U;
+
+        /// Invalid timestamp.
+        const uint32_t INVALID_TIMESTAMP = 4U;
     }
 
     /// The list of errors.
@@ -123,6 +126,36 @@ namespace EXCEPTION
         /// Out of memory.
         const uint32_t OUT_OF_MEMORY = 22U;
 
+        /// Unsorted signal.
+        const uint32_t UNSORTED_SIGNAL = 23U;
+
+        /// Incompatible options.
+        const uint32_t INCOMPATIBLE_OPTIONS = 24U;
+
+        /// Signal beyond the reorder window.
+        const uint32_t SIGNAL_BEYOND_REORDER_WINDOW = 25U;
+
+        /// No signals in the group.
+        const uint32_t NO_GROUP_SIGNALS = 26U;
+
+        /// Invalid description of the line fields.
+        const uint32_t INVALID_FIELDS_DESCRIPTION = 27U;
+
+        /// Invalid CSV layout.
+        const uint32_t INVALID_CSV_LAYOUT = 28U;
+
+        /// CSV column not found.
+        const uint32_t CSV_COLUMN_NOT_FOUND = 29U;
+
+        /// Invalid description of the JSON values.
+        const uint32_t INVALID_JSON_DESCRIPTION = 30U;
+
+        /// Invalid binary layout.
+        const uint32_t INVALID_BINARY_LAYOUT = 31U;
+
+        /// Invalid timestamp format.
+        const uint32_t INVALID_TIMESTAMP_FORMAT = 32U;
+
         // Logic errors below shall never happen.
         // They are enumerated from 9000.
 
@@ -41,17 +41,28 @@ namespace PARSER
             /// @param rRegEx The regular expression matching the log line.
             /// @param rTimestamp The expression to create the timestamp of the signal.
             /// @param rName The expression to create the name of the signal.
+            /// @param pSignalRegEx The compiled regular expression shared with
+            ///                     other creators or nullptr.
             XmlEventSignalCreator(const std::string &rRegEx,
                                   const std::string &rTimestamp,
-                                  const std::string &rName) :
-                XmlSignalCreator(rRegEx, rTimestamp, rName, "", "")
+                                  const std::string &rName,
+                                  const std::shared_ptr<const std::regex> &pSignalRegEx = nullptr) :
+                XmlSignalCreator(rRegEx, rTimestamp, rName, "", "", pSignalRegEx)
             {
             }
 
-            /// @copydoc SignalCreator::Create()
-            virtual SIGNAL::Signal *Create(const std::string &rLogLine,
-                                           INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                           SIGNAL::SourceRegistry::HandleT sourceHandle) const;
+            /// @copydoc XmlSignalCreator::Emit()
+            virtual void Emit(const CaptureGroups &rGroups,
+                              CaptureCache &rCache,
+                              INSTRUMENT::Instrument::LineNumberT lineNumber,
+                              SIGNAL::SourceRegistry::HandleT sourceHandle,
+                              CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<XmlEventSignalCreator>(*this);
+            }
 
     };
 
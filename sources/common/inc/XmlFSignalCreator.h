@@ -44,19 +44,30 @@ namespace PARSER
             /// @param rTimestamp The expression to create the timestamp of the signal.
             /// @param rName The expression to create the name of the signal.
             /// @param rValue The expression to create the value of the signal.
+            /// @param pSignalRegEx The compiled regular expression shared with
+            ///                     other creators or nullptr.
             XmlFSignalCreator(const std::string &rRegEx,
                               const std::string &rTimestamp,
                               const std::string &rName,
-                              const std::string &rValue) :
-                XmlSignalCreator(rRegEx, rTimestamp, rName, rValue, "")
+                              const std::string &rValue,
+                              const std::shared_ptr<const std::regex> &pSignalRegEx = nullptr) :
+                XmlSignalCreator(rRegEx, rTimestamp, rName, rValue, "", pSignalRegEx)
             {
-                m_FloatEvaluator.ParseFloatString(rValue);
+                m_pFloatEvaluator->ParseFloatString(rValue);
             }
 
-            /// @copydoc SignalCreator::Create()
-            virtual SIGNAL::Signal *Create(const std::string &rLogLine,
-                                           INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                           SIGNAL::SourceRegistry::HandleT sourceHandle) const;
+            /// @copydoc XmlSignalCreator::Emit()
+            virtual void Emit(const CaptureGroups &rGroups,
+                              CaptureCache &rCache,
+                              INSTRUMENT::Instrument::LineNumberT lineNumber,
+                              SIGNAL::SourceRegistry::HandleT sourceHandle,
+                              CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<XmlFSignalCreator>(*this);
+            }
 
     };
 
@@ -0,0 +1,118 @@
+/// @file common/inc/XmlFieldsSignalCreator.h
+///
+/// The XML delimiter-separated fields signal creator.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+#include "XmlGroupSignalCreator.h"
+
+namespace PARSER
+{
+    /// The class provides means to create XML signal objects from
+    /// the log lines consisting of delimiter-separated fields.
+
+    /// The XML fields signal creator class.
+    ///
+    /// The log line is split at the delimiter instead of being matched
+    /// with the regular expression. The fields are the groups the signal
+    /// expressions are evaluated over, the first field having index 1.
+    /// The line matches if it has the expected number of fields and
+    /// the guarded fields hold the expected literals.
+    class XmlFieldsSignalCreator : public XmlGroupSignalCreator
+    {
+        public:
+            /// The XML fields signal creator constructor.
+            ///
+            /// @param delimiter The character separating the fields.
+            /// @param fieldCount The number of the fields in the line.
+            XmlFieldsSignalCreator(char delimiter, size_t fieldCount) :
+                XmlGroupSignalCreator(""),
+                m_Delimiter(delimiter),
+                m_FieldCount(fieldCount),
+                m_Guards(),
+                m_Fields()
+            {
+                // The line is followed by its fields.
+                m_Fields.reserve(fieldCount + 1);
+            }
+
+            /// Adds the literal the field must hold for the line to match.
+            ///
+            /// @param field The index of the field.
+            /// @param rLiteral The expected field content.
+            void AddGuard(size_t field, const std::string &rLiteral)
+            {
+                m_Guards.push_back(Guard{field, rLiteral});
+            }
+
+            /// @copydoc SignalCreator::Create()
+            virtual bool Create(const std::string &rLogLine,
+                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<XmlFieldsSignalCreator>(*this);
+            }
+
+        private:
+            /// The literal the field must hold.
+            struct Guard
+            {
+                /// The index of the field.
+                size_t m_Field;
+
+                /// The expected field content.
+                std::string m_Literal;
+            };
+
+            /// Splits the log line into the fields.
+            ///
+            /// @param rLogLine The log line.
+            /// @return True if the line has the expected number of fields.
+            bool Split(const std::string &rLogLine) const;
+
+            /// The character separating the fields.
+            const char m_Delimiter;
+
+            /// The number of the fields in the line.
+            const size_t m_FieldCount;
+
+            /// The literals the fields must hold.
+            std::vector<Guard> m_Guards;
+
+            /// The line followed by its fields.
+            /// The storage is reused for every line. Each copy of the creator
+            /// has its own one.
+            mutable std::vector<std::string_view> m_Fields;
+    };
+
+}
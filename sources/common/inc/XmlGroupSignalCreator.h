@@ -0,0 +1,132 @@
+/// @file common/inc/XmlGroupSignalCreator.h
+///
+/// The XML group signal creator.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "SignalCreator.h"
+#include "XmlSignalCreator.h"
+#include "CaptureCache.h"
+#include "CaptureGroups.h"
+
+namespace PARSER
+{
+    /// The class provides means to create several XML signal objects
+    /// from one log line.
+
+    /// The XML group signal creator class.
+    ///
+    /// The log line is matched only once. Each signal of the group is then
+    /// created by its own expressions evaluated over the shared regex groups.
+    class XmlGroupSignalCreator : public SignalCreator
+    {
+        public:
+            /// The XML group signal creator constructor.
+            ///
+            /// @param rRegEx The regular expression matching the log line.
+            XmlGroupSignalCreator(const std::string &rRegEx) :
+                SignalCreator(rRegEx),
+                m_vpSignals(),
+                m_CaptureCache()
+            {
+            }
+
+            /// Adds the vector signal to the group.
+            ///
+            /// @param rTimestamp The expression to create the timestamp of the signal.
+            /// @param rName The expression to create the name of the signal.
+            /// @param rValue The expression to create the value of the signal.
+            /// @param rSize The expression to create the size of the signal.
+            /// @param rTimestampFormat The format of the timestamp.
+            void AddVector(const std::string &rTimestamp,
+                           const std::string &rName,
+                           const std::string &rValue,
+                           const std::string &rSize,
+                           const TimestampFormat &rTimestampFormat = TimestampFormat());
+
+            /// Adds the real signal to the group.
+            ///
+            /// @param rTimestamp The expression to create the timestamp of the signal.
+            /// @param rName The expression to create the name of the signal.
+            /// @param rValue The expression to create the value of the signal.
+            /// @param rTimestampFormat The format of the timestamp.
+            void AddReal(const std::string &rTimestamp,
+                         const std::string &rName,
+                         const std::string &rValue,
+                         const TimestampFormat &rTimestampFormat = TimestampFormat());
+
+            /// Adds the event signal to the group.
+            ///
+            /// @param rTimestamp The expression to create the timestamp of the signal.
+            /// @param rName The expression to create the name of the signal.
+            /// @param rTimestampFormat The format of the timestamp.
+            void AddEvent(const std::string &rTimestamp,
+                          const std::string &rName,
+                          const TimestampFormat &rTimestampFormat = TimestampFormat());
+
+            /// Returns true if the group contains no signals.
+            bool IsEmpty() const
+            {
+                return m_vpSignals.empty();
+            }
+
+            /// @copydoc SignalCreator::Create()
+            virtual bool Create(const std::string &rLogLine,
+                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<XmlGroupSignalCreator>(*this);
+            }
+
+        protected:
+            /// Creates all the signals of the group from the matched line.
+            ///
+            /// @param rGroups The groups of the log line.
+            /// @param lineNumber The log line number.
+            /// @param sourceHandle Signal source handle.
+            /// @param rSink The receiver of the created signals and warnings.
+            void EmitSignals(const CaptureGroups &rGroups,
+                             INSTRUMENT::Instrument::LineNumberT lineNumber,
+                             SIGNAL::SourceRegistry::HandleT sourceHandle,
+                             CreationSink &rSink) const;
+
+        private:
+            /// The creators of the signals in the group.
+            /// They are only evaluated over the groups matched by the group
+            /// creator, so the copies of the group share them.
+            std::vector<std::shared_ptr<const XmlSignalCreator>> m_vpSignals;
+
+            /// The groups converted while evaluating the matched line.
+            mutable CaptureCache m_CaptureCache;
+    };
+
+}
@@ -41,17 +41,26 @@ namespace PARSER
                               const std::string &rTimestamp,
                               const std::string &rName,
                               const std::string &rValue,
-                              const std::string &rSize) :
-                XmlSignalCreator(rRegEx, rTimestamp, rName, rValue, rSize)
+                              const std::string &rSize,
+                              const std::shared_ptr<const std::regex> &pSignalRegEx = nullptr) :
+                XmlSignalCreator(rRegEx, rTimestamp, rName, rValue, rSize, pSignalRegEx)
             {
-                m_DecimalEvaluator.ParseDecimalString(rValue);
-                m_SizeEvaluator.ParseDecimalString(rSize);
+                m_pDecimalEvaluator->ParseDecimalString(rValue);
+                m_pSizeEvaluator->ParseDecimalString(rSize);
             }
 
-            /// @copydoc SignalCreator::Create()
-            virtual SIGNAL::Signal *Create(const std::string &rLogLine,
-                                           INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                           SIGNAL::SourceRegistry::HandleT sourceHandle) const;
+            /// @copydoc XmlSignalCreator::Emit()
+            virtual void Emit(const CaptureGroups &rGroups,
+                              CaptureCache &rCache,
+                              INSTRUMENT::Instrument::LineNumberT lineNumber,
+                              SIGNAL::SourceRegistry::HandleT sourceHandle,
+                              CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<XmlISignalCreator>(*this);
+            }
     };
 
 }
@@ -0,0 +1,105 @@
+/// @file common/inc/XmlJsonSignalCreator.h
+///
+/// The XML JSON signal creator.
+///
+/// @par Full Description
+/// The class provides means to create XML signal objects from
+/// the JSON log lines.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include "XmlGroupSignalCreator.h"
+#include "JsonExtractor.h"
+
+namespace PARSER
+{
+    /// The XML JSON signal creator class.
+    ///
+    /// The log line holds one JSON value. The values of the given paths
+    /// are the groups the signal expressions are evaluated over, the first
+    /// path having index 1. The line matches if all the paths are found
+    /// and the guarded values equal the expected literals.
+    class XmlJsonSignalCreator : public XmlGroupSignalCreator
+    {
+        public:
+            /// The XML JSON signal creator constructor.
+            XmlJsonSignalCreator() :
+                XmlGroupSignalCreator(""),
+                m_Extractor(),
+                m_Guards()
+            {
+            }
+
+            /// Adds the path of the value the expressions refer to.
+            ///
+            /// @throws VcdError if the path is invalid.
+            /// @param rPath The path of the value.
+            /// @return The index of the value.
+            size_t AddPath(const std::string &rPath)
+            {
+                return m_Extractor.AddPath(rPath);
+            }
+
+            /// Adds the literal the value must equal for the line to match.
+            ///
+            /// @param value The index of the value.
+            /// @param rLiteral The expected value.
+            void AddGuard(size_t value, const std::string &rLiteral)
+            {
+                m_Guards.push_back(Guard{value, rLiteral});
+            }
+
+            /// @copydoc SignalCreator::Create()
+            virtual bool Create(const std::string &rLogLine,
+                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                CreationSink &rSink) const;
+
+            /// @copydoc SignalCreator::Clone()
+            virtual std::unique_ptr<SignalCreator> Clone() const
+            {
+                return std::make_unique<XmlJsonSignalCreator>(*this);
+            }
+
+        private:
+            /// The literal the value must equal.
+            struct Guard
+            {
+                /// The index of the value.
+                size_t m_Value;
+
+                /// The expected value.
+                std::string m_Literal;
+            };
+
+            /// The extractor of the values.
+            /// Each copy of the creator has its own one.
+            JsonExtractor m_Extractor;
+
+            /// The literals the values must equal.
+            std::vector<Guard> m_Guards;
+    };
+
+}
@@ -26,13 +26,49 @@
 
 #pragma once
 
+#include <memory>
+
 #include "SignalCreator.h"
 #include "Evaluator.h"
 #include "ExpressionContext.h"
+#include "CaptureCache.h"
+#include "CaptureGroups.h"
 #include "ExpressionNode.h"
 
 namespace PARSER
 {
+    /// The format of the signal timestamp.
+    struct TimestampFormat
+    {
+        /// The kinds of the timestamps.
+        enum class Kind : uint8_t
+        {
+            /// The timestamp is evaluated from the expression.
+            EXPRESSION,
+
+            /// The time of day, e.g. '12:03:44.123456'.
+            TIME_OF_DAY,
+
+            /// The seconds since the epoch, e.g. '1712345678.000123'.
+            EPOCH,
+
+            /// The decimal number of the time units, e.g. '2.5 ms'.
+            DECIMAL
+        };
+
+        /// The kind of the timestamp.
+        Kind m_Kind;
+
+        /// The index of the group holding the timestamp.
+        size_t m_Group;
+
+        /// The time unit index of the decimal timestamps without the unit.
+        size_t m_Unit;
+
+        /// The time unit index of the log time base.
+        size_t m_TimeBase;
+    };
+
     /// The class provides means to create XML signal objects.
 
     ///  An XML signal creator class.
@@ -46,53 +82,143 @@ namespace PARSER
             /// @param rName The expression to create the name of the signal.
             /// @param rValue The expression to create the value of the signal.
             /// @param rSize The expression to create the size of the signal.
+            /// @param pSignalRegEx The compiled regular expression shared with
+            ///                     other creators or nullptr.
             XmlSignalCreator(const std::string &rRegEx,
                              const std::string &rTimestamp,
                              const std::string &rName,
                              const std::string &rValue,
-                             const std::string &rSize):
-                SignalCreator(rRegEx),
+                             const std::string &rSize,
+                             const std::shared_ptr<const std::regex> &pSignalRegEx = nullptr):
+                SignalCreator(rRegEx, pSignalRegEx),
                 m_Timestamp(rTimestamp),
                 m_Name(rName),
                 m_Value(rValue),
                 m_Size(rSize),
-                m_TimestampEvaluator("XML"),
-                m_DecimalEvaluator("XML"),
-                m_FloatEvaluator("XML"),
-                m_SizeEvaluator("XML"),
-                m_NameEvaluator("XML")
+                m_pTimestampEvaluator(std::make_shared<Evaluator>("XML")),
+                m_pDecimalEvaluator(std::make_shared<Evaluator>("XML")),
+                m_pFloatEvaluator(std::make_shared<Evaluator>("XML")),
+                m_pSizeEvaluator(std::make_shared<Evaluator>("XML")),
+                m_pNameEvaluator(std::make_shared<Evaluator>("XML")),
+                m_TimestampFormat(),
+                m_CaptureCache()
+            {
+                m_pTimestampEvaluator->ParseDecimalString(rTimestamp);
+                m_pNameEvaluator->ParseStringString(rName);
+            }
+
+            /// The XML signal creator copy constructor.
+            ///
+            /// The copy shares the parsed expressions, but it has its own
+            /// capture cache, so that the copies may be used by different threads.
+            ///
+            /// @param rOther The copied creator.
+            XmlSignalCreator(const XmlSignalCreator &rOther) :
+                SignalCreator(rOther),
+                m_Timestamp(rOther.m_Timestamp),
+                m_Name(rOther.m_Name),
+                m_Value(rOther.m_Value),
+                m_Size(rOther.m_Size),
+                m_pTimestampEvaluator(rOther.m_pTimestampEvaluator),
+                m_pDecimalEvaluator(rOther.m_pDecimalEvaluator),
+                m_pFloatEvaluator(rOther.m_pFloatEvaluator),
+                m_pSizeEvaluator(rOther.m_pSizeEvaluator),
+                m_pNameEvaluator(rOther.m_pNameEvaluator),
+                m_TimestampFormat(rOther.m_TimestampFormat),
+                m_CaptureCache()
             {
-                m_TimestampEvaluator.ParseDecimalString(rTimestamp);
-                m_NameEvaluator.ParseStringString(rName);
             }
 
+            /// The creator is not assignable.
+            XmlSignalCreator &operator=(const XmlSignalCreator &) = delete;
+
+            /// Sets the format of the timestamp.
+            ///
+            /// Unless the timestamp is evaluated from the expression,
+            /// the timestamp expression is ignored and the timestamp is
+            /// converted directly from the group given by the format.
+            ///
+            /// @param rTimestampFormat The format of the timestamp.
+            void SetTimestampFormat(const TimestampFormat &rTimestampFormat)
+            {
+                m_TimestampFormat = rTimestampFormat;
+            }
+
+            /// @copydoc SignalCreator::Create()
+            virtual bool Create(const std::string &rLogLine,
+                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                CreationSink &rSink) const;
+
+            /// Creates the signal from the matched log line.
+            ///
+            /// The line may have been matched by another creator, e.g. by
+            /// a group of signals sharing the regular expression.
+            ///
+            /// @param rGroups The groups of the log line.
+            /// @param rCache The groups converted while evaluating the line.
+            /// @param lineNumber The log line number.
+            /// @param sourceHandle Signal source handle.
+            /// @param rSink The receiver of the created signal or the warning.
+            virtual void Emit(const CaptureGroups &rGroups,
+                              CaptureCache &rCache,
+                              INSTRUMENT::Instrument::LineNumberT lineNumber,
+                              SIGNAL::SourceRegistry::HandleT sourceHandle,
+                              CreationSink &rSink) const = 0;
+
         protected:
             /// Returns the timestamp of the signal.
             ///
-            /// @param rMatch The regular expression groups.
+            /// The timestamp of the native format which cannot be converted
+            /// results in the warning.
+            ///
+            /// @throws EvaluatorException if the timestamp cannot be evaluated.
+            /// @param rGroups The groups of the log line.
+            /// @param rCache The groups converted while evaluating the line.
             /// @param lineNumber The log line number.
-            TIME::Timestamp GetTimestamp(const std::smatch &rMatch,
-                                         INSTRUMENT::Instrument::LineNumberT lineNumber) const;
+            /// @param rSink The receiver of the warning.
+            /// @param rTimestamp The timestamp of the signal.
+            /// @return True if the timestamp has been created.
+            bool GetTimestamp(const CaptureGroups &rGroups,
+                              CaptureCache &rCache,
+                              INSTRUMENT::Instrument::LineNumberT lineNumber,
+                              CreationSink &rSink,
+                              TIME::Timestamp &rTimestamp) const;
 
             /// Returns the name of the signal.
             ///
-            /// @param rMatch The regular expression groups.
-            std::string GetName(const std::smatch &rMatch) const;
+            /// @param rGroups The groups of the log line.
+            /// @param rCache The groups converted while evaluating the line.
+            std::string GetName(const CaptureGroups &rGroups, CaptureCache &rCache) const;
 
             /// Returns the decimal value of the signal.
             ///
-            /// @param rMatch The regular expression groups.
-            SafeUInt<uint64_t> GetDecimalValue(const std::smatch &rMatch) const;
+            /// @param rGroups The groups of the log line.
+            /// @param rCache The groups converted while evaluating the line.
+            SafeUInt<uint64_t> GetDecimalValue(const CaptureGroups &rGroups, CaptureCache &rCache) const;
 
             /// Returns the float value of the signal.
             ///
-            /// @param rMatch The regular expression groups.
-            std::string GetFloatValue(const std::smatch &rMatch) const;
+            /// @param rGroups The groups of the log line.
+            /// @param rCache The groups converted while evaluating the line.
+            std::string GetFloatValue(const CaptureGroups &rGroups, CaptureCache &rCache) const;
 
             /// Returns the size of the signal.
             ///
-            /// @param rMatch The regular expression groups.
-            size_t GetSize(const std::smatch &rMatch) const;
+            /// @param rGroups The groups of the log line.
+            /// @param rCache The groups converted while evaluating the line.
+            size_t GetSize(const CaptureGroups &rGroups, CaptureCache &rCache) const;
+
+            /// Converts the timestamp of the native format.
+            ///
+            /// @throws EvaluatorException if the group index is out of range.
+            /// @param rGroups The groups of the log line.
+            /// @param rSink The receiver of the warning.
+            /// @param rTimestamp The converted timestamp.
+            /// @return True if the timestamp has been converted.
+            bool ConvertTimestamp(const CaptureGroups &rGroups,
+                                  CreationSink &rSink,
+                                  TIME::Timestamp &rTimestamp) const;
 
             /// The expression to create the timestamp of the signal.
             const std::string m_Timestamp;
@@ -106,19 +232,30 @@ namespace PARSER
             /// The expression to create the size of the signal.
             const std::string m_Size;
 
+            /// The evaluators are shared by the copies of the creator.
+            /// They are modified only while the creator is being constructed.
+
             /// The timestamp evaluator.
-            Evaluator m_TimestampEvaluator;
+            std::shared_ptr<Evaluator> m_pTimestampEvaluator;
 
             /// The decimal(vector) value evaluator.
-            Evaluator m_DecimalEvaluator;
+            std::shared_ptr<Evaluator> m_pDecimalEvaluator;
 
             /// The float value evaluator.
-            Evaluator m_FloatEvaluator;
+            std::shared_ptr<Evaluator> m_pFloatEvaluator;
 
             /// The size evaluator.
-            Evaluator m_SizeEvaluator;
+            std::shared_ptr<Evaluator> m_pSizeEvaluator;
 
             /// The name evaluator.
-            Evaluator m_NameEvaluator;
+            std::shared_ptr<Evaluator> m_pNameEvaluator;
+
+            /// The format of the timestamp.
+            TimestampFormat m_TimestampFormat;
+
+            /// The groups converted while evaluating the matched line.
+            /// It is the only state modified by the creation, so a copy of
+            /// the creator is needed per thread.
+            mutable CaptureCache m_CaptureCache;
     };
 }
@@ -37,6 +37,11 @@
 
 namespace PARSER
 {
+    // Declared in XmlGroupSignalCreator.h, which depends on the parser
+    // headers not visible to the tool sources.
+    class XmlGroupSignalCreator;
+    struct TimestampFormat;
+
     /// The class stores XML signal creation parameters.
 
     /// The XML description class.
@@ -56,6 +61,14 @@ namespace PARSER
             /// Returns the timestamp tag value.
             const std::string &GetTimestamp() const;
 
+            /// Returns the format of the timestamp.
+            ///
+            /// The value of the timestamp tag of the native formats
+            /// is the index of the group holding the timestamp.
+            ///
+            /// @param timeBase The time unit index of the log time base.
+            TimestampFormat GetTimestampFormat(size_t timeBase) const;
+
             /// Returns the name tag value.
             const std::string &GetName() const;
 
@@ -73,6 +86,12 @@ namespace PARSER
             /// Stores the XML timestamp tag value.
             std::string m_Timestamp;
 
+            /// Stores the XML timestamp format attribute.
+            std::string m_TimestampFormat;
+
+            /// Stores the XML timestamp unit attribute.
+            std::string m_TimestampUnit;
+
             /// Stores the XML name tag value.
             std::string m_Name;
 
@@ -94,6 +113,49 @@ namespace PARSER
             /// The XML signal factory default constructor.
             ///
             /// @param rXmlFileName The name of the XML file specifying the user log syntax.
-            XmlSignalFactory(const std::string &rXmlFileName);
+            /// @param rTimeBase The time base used in the log.
+            XmlSignalFactory(const std::string &rXmlFileName, const std::string &rTimeBase);
+
+        private:
+
+            /// Creates the creator of the signal group.
+            ///
+            /// The signals of the group may override the timestamp
+            /// expression of the group.
+            ///
+            /// @param rGroup The XML group node.
+            /// @return The group signal creator.
+            std::unique_ptr<SignalCreator> CreateGroup(const pugi::xml_node &rGroup) const;
+
+            /// Creates the creator of the signals from the delimiter-separated fields.
+            ///
+            /// The fields are described by the delimiter and count attributes.
+            /// The optional guards specify the literals the fields must hold.
+            ///
+            /// @param rFields The XML fields node.
+            /// @return The fields signal creator.
+            std::unique_ptr<SignalCreator> CreateFields(const pugi::xml_node &rFields) const;
+
+            /// Creates the creator of the signals from the JSON log lines.
+            ///
+            /// The paths of the values the expressions refer to are given
+            /// in the order of their indexes. The optional value attribute
+            /// of the path specifies the literal the value must equal.
+            ///
+            /// @param rJson The XML json node.
+            /// @return The JSON signal creator.
+            std::unique_ptr<SignalCreator> CreateJson(const pugi::xml_node &rJson) const;
+
+            /// Adds the signals of the group.
+            ///
+            /// @param rGroup The XML group, fields or json node.
+            /// @param pMatchingTag The tag describing how the line is matched.
+            /// @param rCreator The creator the signals are added to.
+            void AddGroupSignals(const pugi::xml_node &rGroup,
+                                 const char *pMatchingTag,
+                                 XmlGroupSignalCreator &rCreator) const;
+
+            /// The time unit index of the log time base.
+            size_t m_TimeBase;
     };
 }
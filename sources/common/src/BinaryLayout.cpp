@@ -0,0 +1,338 @@
+/// @file common/src/BinaryLayout.cpp
+///
+/// The binary log layout.
+///
+/// @par Full Description
+/// The layout describes the fixed-size records of the binary logs and
+/// creates the signals from them.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cstring>
+
+#include "BinaryLayout.h"
+#include "ISignal.h"
+#include "FSignal.h"
+#include "EventSignal.h"
+#include "NumberConverter.h"
+#include "VcdException.h"
+
+PARSER::BinaryLayout::BinaryLayout(const std::string &rXmlFileName) :
+    m_RecordSize(0),
+    m_HeaderSize(0),
+    m_Port(0),
+    m_BigEndian(false),
+    m_Timestamp{0, 0},
+    m_Id{0, 0},
+    m_Value{0, 0},
+    m_Signals()
+{
+    pugi::xml_document doc;
+    if (!doc.load_file(rXmlFileName.c_str()))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::XML_READ_ERROR,
+                                      "Opening XML file '" + rXmlFileName + "' failed. The XML file might be incorrect.");
+    }
+
+    const pugi::xml_node binary = doc.child("signals").child("binary");
+    if (!binary)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - No binary tag in " + rXmlFileName + ".");
+    }
+
+    uint64_t recordSize = 0;
+    if (!ConvertNumber(binary.attribute("record").value(), recordSize) || (0 == recordSize))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - Invalid binary record size: '" + std::string(binary.attribute("record").value()) + "'");
+    }
+    m_RecordSize = static_cast<size_t>(recordSize);
+
+    // There is no file header by default.
+    uint64_t headerSize = 0;
+    if (binary.attribute("header") && !ConvertNumber(binary.attribute("header").value(), headerSize))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - Invalid binary header size: '" + std::string(binary.attribute("header").value()) + "'");
+    }
+    m_HeaderSize = static_cast<size_t>(headerSize);
+
+    // The captured datagrams of all the ports are decoded by default.
+    uint64_t port = 0;
+    if (binary.attribute("port") && (!ConvertNumber(binary.attribute("port").value(), port) || (port > 0xFFFFU)))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - Invalid UDP port: '" + std::string(binary.attribute("port").value()) + "'");
+    }
+    m_Port = static_cast<uint16_t>(port);
+
+    // The fields are little endian by default.
+    const std::string endianness = binary.attribute("endianness").value();
+    if ("big" == endianness)
+    {
+        m_BigEndian = true;
+    }
+    else if (!endianness.empty() && ("little" != endianness))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - Invalid endianness: '" + endianness + "'");
+    }
+
+    bool hasValues = false;
+
+    for (const pugi::xml_node &node : binary.children())
+    {
+        if (0 == std::strcmp("field", node.name()))
+        {
+            const std::string role = node.attribute("role").value();
+            if ("timestamp" == role)
+            {
+                ReadField(node, m_Timestamp);
+            }
+            else if ("id" == role)
+            {
+                ReadField(node, m_Id);
+            }
+            else if ("value" == role)
+            {
+                ReadField(node, m_Value);
+            }
+            else
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                              "XML - Invalid binary field role: '" + role + "'");
+            }
+        }
+        else if (0 == std::strcmp("signal", node.name()))
+        {
+            uint64_t id = 0;
+            if (!ConvertNumber(node.attribute("id").value(), id))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                              "XML - Invalid signal identifier: '" + std::string(node.attribute("id").value()) + "'");
+            }
+
+            Entry entry{node.attribute("name").value(), SignalT::EVENT, 0};
+            if (entry.m_Name.empty())
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                              "XML - No name of the signal " + std::to_string(id) + ".");
+            }
+
+            const std::string type = node.attribute("type").value();
+            if ("vector" == type)
+            {
+                uint64_t size = 0;
+                if (!ConvertNumber(node.attribute("size").value(), size) || (0 == size) || (size > 64))
+                {
+                    throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                                  "XML - Invalid size of the signal " + entry.m_Name + ".");
+                }
+                entry.m_Type = SignalT::VECTOR;
+                entry.m_Size = static_cast<size_t>(size);
+                hasValues = true;
+            }
+            else if ("real" == type)
+            {
+                entry.m_Type = SignalT::REAL;
+                hasValues = true;
+            }
+            else if ("event" != type)
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                              "XML - Invalid type of the signal " + entry.m_Name + ": '" + type + "'");
+            }
+
+            if (!m_Signals.emplace(id, entry).second)
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                              "XML - Duplicated signal identifier: " + std::to_string(id));
+            }
+        }
+        else
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::UNEXPECTED_TAG,
+                                          "XML - Unexpected tag: " + std::string(node.name()));
+        }
+    }
+
+    if (m_Signals.empty())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - No binary signals.");
+    }
+
+    if (0 == m_Id.m_Width)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - No signal identifier field.");
+    }
+
+    if (hasValues && (0 == m_Value.m_Width))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - No value field.");
+    }
+
+    // The real values are the single or double precision numbers.
+    for (const auto &rSignal : m_Signals)
+    {
+        if ((SignalT::REAL == rSignal.second.m_Type) && (4 != m_Value.m_Width) && (8 != m_Value.m_Width))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                          "XML - The real values must be 4 or 8 bytes wide.");
+        }
+    }
+}
+
+bool PARSER::BinaryLayout::CreateSignal(const unsigned char *pRecord,
+                                        uint64_t timestamp,
+                                        SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                        std::vector<SIGNAL::Signal *> &rvpSignals,
+                                        std::string &rWarning) const
+{
+    const auto signal = m_Signals.find(GetId(pRecord));
+    if (m_Signals.end() == signal)
+    {
+        return false;
+    }
+
+    const Entry &rEntry = signal->second;
+
+    switch (rEntry.m_Type)
+    {
+        case SignalT::VECTOR:
+        {
+            const uint64_t value = Read(pRecord, m_Value);
+            if (SIGNAL::ISignal::IsValueInRange(value, rEntry.m_Size))
+            {
+                rvpSignals.push_back(new SIGNAL::ISignal(rEntry.m_Name,
+                                                         rEntry.m_Size,
+                                                         timestamp,
+                                                         value,
+                                                         sourceHandle));
+            }
+            else
+            {
+                rWarning = EXCEPTION::TooSmallVector::GetMessage(value, rEntry.m_Size);
+            }
+            break;
+        }
+
+        case SignalT::REAL:
+        {
+            const uint64_t bits = Read(pRecord, m_Value);
+            double value = 0;
+
+            if (4 == m_Value.m_Width)
+            {
+                const uint32_t singleBits = static_cast<uint32_t>(bits);
+                float singleValue = 0;
+                std::memcpy(&singleValue, &singleBits, sizeof(singleValue));
+                value = singleValue;
+            }
+            else
+            {
+                std::memcpy(&value, &bits, sizeof(value));
+            }
+
+            rvpSignals.push_back(new SIGNAL::FSignal(rEntry.m_Name,
+                                                     timestamp,
+                                                     UTILS::NumberConverter::PrintFloat(value, 4 == m_Value.m_Width),
+                                                     sourceHandle));
+            break;
+        }
+
+        case SignalT::EVENT:
+            rvpSignals.push_back(new SIGNAL::EventSignal(rEntry.m_Name,
+                                                         timestamp,
+                                                         sourceHandle));
+            break;
+    }
+
+    return true;
+}
+
+uint64_t PARSER::BinaryLayout::Read(const unsigned char *pRecord, const Field &rField) const
+{
+    const unsigned char *pField = pRecord + rField.m_Offset;
+    uint64_t value = 0;
+
+    if (m_BigEndian)
+    {
+        for (size_t byte = 0; byte < rField.m_Width; ++byte)
+        {
+            value = (value << 8) | pField[byte];
+        }
+    }
+    else
+    {
+        for (size_t byte = rField.m_Width; byte > 0; --byte)
+        {
+            value = (value << 8) | pField[byte - 1];
+        }
+    }
+
+    return value;
+}
+
+void PARSER::BinaryLayout::ReadField(const pugi::xml_node &rNode, Field &rField) const
+{
+    uint64_t offset = 0;
+    uint64_t width = 0;
+
+    if (!ConvertNumber(rNode.attribute("offset").value(), offset) ||
+        !ConvertNumber(rNode.attribute("width").value(), width) ||
+        (0 == width) ||
+        (width > 8) ||
+        (offset > m_RecordSize) ||
+        ((offset + width) > m_RecordSize))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - Invalid binary field: '" + std::string(rNode.attribute("role").value()) + "'");
+    }
+
+    rField.m_Offset = static_cast<size_t>(offset);
+    rField.m_Width = static_cast<size_t>(width);
+}
+
+bool PARSER::BinaryLayout::ConvertNumber(const char *pText, uint64_t &rValue)
+{
+    const std::string_view text(pText);
+
+    // The whole text must be the number.
+    if (text.empty() || (std::string_view::npos != text.find_first_not_of("0123456789abcdefABCDEFxX")))
+    {
+        return false;
+    }
+
+    if ((text.size() > 2) && ('0' == text[0]) && (('x' == text[1]) || ('X' == text[1])))
+    {
+        return (UTILS::ConversionStatus::OK == UTILS::NumberConverter::ConvertHex(text, rValue)) &&
+               (std::string_view::npos == text.find_first_not_of("0123456789abcdefABCDEF", 2));
+    }
+
+    return (UTILS::ConversionStatus::OK == UTILS::NumberConverter::ConvertDecimal(text, rValue)) &&
+           (std::string_view::npos == text.find_first_not_of("0123456789"));
+}
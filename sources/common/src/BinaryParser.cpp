@@ -0,0 +1,130 @@
+/// @file common/src/BinaryParser.cpp
+///
+/// The binary log parser.
+///
+/// @par Full Description
+/// The parser creates the signals from the fixed-size records of the
+/// binary log.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <iostream>
+
+#include "BinaryParser.h"
+#include "MappedFile.h"
+#include "Logger.h"
+#include "VcdException.h"
+
+PARSER::BinaryParser::BinaryParser(const std::string &rFilename,
+                                   const std::string &rTimeBase,
+                                   SIGNAL::SourceRegistry &rSourceRegistry,
+                                   const BinaryLayout &rLayout,
+                                   bool verboseMode) :
+    LogParser(rFilename, rTimeBase, rSourceRegistry, verboseMode),
+    m_rLayout(rLayout),
+    m_ValidRecords(0),
+    m_InvalidRecords(0)
+{
+    if (!m_rLayout.HasTimestamp())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_BINARY_LAYOUT,
+                                      "XML - No timestamp field.");
+    }
+}
+
+PARSER::BinaryParser::~BinaryParser()
+{
+    if (0 == std::uncaught_exceptions())
+    {
+        // Print the summary.
+        std::cout << '\n' << "Parsed " << m_FileName << ": \n";
+        std::cout << "Valid lines:   " << m_ValidRecords << '\n';
+        std::cout << "Invalid lines: " << m_InvalidRecords << '\n';
+    }
+}
+
+void PARSER::BinaryParser::Parse()
+{
+    // The log may be parsed more than once.
+    m_ValidRecords = 0;
+    m_InvalidRecords = 0;
+
+    const UTILS::MappedFile log(m_FileName);
+    const size_t recordSize = m_rLayout.GetRecordSize();
+
+    if (log.GetSize() < m_rLayout.GetHeaderSize())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                      "Binary - The file " + m_FileName + " is shorter than its header.");
+    }
+
+    const unsigned char *pRecord = log.GetData() + m_rLayout.GetHeaderSize();
+    const size_t recordCount = (log.GetSize() - m_rLayout.GetHeaderSize()) / recordSize;
+
+    std::vector<SIGNAL::Signal *> vpSignals;
+    std::string warning;
+
+    for (INSTRUMENT::Instrument::LineNumberT recordNumber = 1; recordNumber <= recordCount; ++recordNumber)
+    {
+        if (m_rLayout.CreateSignal(pRecord, m_rLayout.GetTimestamp(pRecord), m_SourceHandle, vpSignals, warning))
+        {
+            if (!warning.empty())
+            {
+                LOGGER::Logger::GetInstance().LogWarning(EXCEPTION::Warning::INSUFFICIENT_VECTOR_SIZE,
+                                                         "Evaluating " + m_FileName + ".\n" +
+                                                         "Record " + std::to_string(recordNumber) + ".\n" +
+                                                         warning);
+                warning.clear();
+            }
+
+            AddSignals(vpSignals, recordNumber);
+            ++m_ValidRecords;
+        }
+        else
+        {
+            if (m_VerboseMode)
+            {
+                std::cout << "Invalid log record "
+                          << recordNumber
+                          << ": unknown signal identifier "
+                          << m_rLayout.GetId(pRecord)
+                          << '\n';
+            }
+            ++m_InvalidRecords;
+        }
+
+        pRecord += recordSize;
+    }
+
+    // The last record is incomplete.
+    if (0 != ((log.GetSize() - m_rLayout.GetHeaderSize()) % recordSize))
+    {
+        if (m_VerboseMode)
+        {
+            std::cout << "Invalid log record "
+                      << recordCount + 1
+                      << ": incomplete record\n";
+        }
+        ++m_InvalidRecords;
+    }
+}
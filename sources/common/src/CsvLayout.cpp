@@ -0,0 +1,128 @@
+/// @file common/src/CsvLayout.cpp
+///
+/// The CSV log layout.
+///
+/// @par Full Description
+/// The layout maps the CSV columns to the signals. It is read from the user
+/// log format XML description.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cstring>
+#include <pugixml.hpp>
+
+#include "CsvLayout.h"
+#include "NumberConverter.h"
+#include "Utils.h"
+#include "VcdException.h"
+
+PARSER::CsvLayout::CsvLayout(const std::string &rXmlFileName) :
+    m_Delimiter(','),
+    m_TimestampColumn(),
+    m_Columns()
+{
+    pugi::xml_document doc;
+    if (!doc.load_file(rXmlFileName.c_str()))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::XML_READ_ERROR,
+                                      "Opening XML file '" + rXmlFileName + "' failed. The XML file might be incorrect.");
+    }
+
+    const pugi::xml_node csv = doc.child("signals").child("csv");
+    if (!csv)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_CSV_LAYOUT,
+                                      "XML - No csv tag in " + rXmlFileName + ".");
+    }
+
+    // The comma is the default delimiter.
+    const std::string delimiter = csv.attribute("delimiter").value();
+    if (!delimiter.empty() &&
+        (!UTILS::ConvertDelimiter(delimiter, m_Delimiter) ||
+         ('"' == m_Delimiter) || ('\r' == m_Delimiter) || ('\n' == m_Delimiter)))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_CSV_LAYOUT,
+                                      "XML - The CSV delimiter must be a single character other than the quote or the line break: '" + delimiter + "'");
+    }
+
+    m_TimestampColumn = csv.attribute("timestamp").value();
+    if (m_TimestampColumn.empty())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::NO_TIMESTAMP_EXPRESSION,
+                                      "XML - No CSV timestamp column.");
+    }
+
+    for (const pugi::xml_node &column : csv.children())
+    {
+        if (0 != std::strcmp("column", column.name()))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::UNEXPECTED_TAG,
+                                          "XML - Unexpected tag: " + std::string(column.name()));
+        }
+
+        Column signalColumn{column.attribute("header").value(),
+                            column.attribute("name").value(),
+                            ColumnT::REAL,
+                            64};
+
+        if (signalColumn.m_Header.empty())
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_CSV_LAYOUT,
+                                          "XML - No CSV column header.");
+        }
+
+        // The column header is used unless the signal name is given.
+        if (signalColumn.m_Name.empty())
+        {
+            signalColumn.m_Name = signalColumn.m_Header;
+        }
+
+        const std::string type = column.attribute("type").value();
+        if ("vector" == type)
+        {
+            uint64_t size = 0;
+            if ((UTILS::ConversionStatus::OK != UTILS::NumberConverter::ConvertDecimal(column.attribute("size").value(), size)) ||
+                (0 == size) ||
+                (size > 64))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_CSV_LAYOUT,
+                                              "XML - Invalid size of the CSV column " + signalColumn.m_Header + ".");
+            }
+            signalColumn.m_Type = ColumnT::VECTOR;
+            signalColumn.m_Size = static_cast<size_t>(size);
+        }
+        else if ("real" != type)
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_CSV_LAYOUT,
+                                          "XML - Invalid type of the CSV column " + signalColumn.m_Header + ": '" + type + "'");
+        }
+
+        m_Columns.push_back(signalColumn);
+    }
+
+    if (m_Columns.empty())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_CSV_LAYOUT,
+                                      "XML - No CSV signal columns.");
+    }
+}
@@ -0,0 +1,446 @@
+/// @file common/src/CsvParser.cpp
+///
+/// The CSV log parser.
+///
+/// @par Full Description
+/// The parser creates the vector and real signals from the columns of the
+/// CSV rows. The columns are identified by the header row.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+
+#include "CsvParser.h"
+#include "ISignal.h"
+#include "FSignal.h"
+#include "NumberConverter.h"
+#include "Logger.h"
+#include "VcdException.h"
+
+PARSER::CsvParser::CsvParser(const std::string &rFilename,
+                             const std::string &rTimeBase,
+                             SIGNAL::SourceRegistry &rSourceRegistry,
+                             const CsvLayout &rLayout,
+                             bool verboseMode) :
+    LogParser(rFilename, rTimeBase, rSourceRegistry, verboseMode),
+    m_rLayout(rLayout),
+    m_Scanner(rLayout.GetDelimiter()),
+    m_Buffer(BLOCK_SIZE),
+    m_Begin(0),
+    m_End(0),
+    m_Fields(),
+    m_Unquoted(),
+    m_HeaderColumns(0),
+    m_TimestampIndex(0),
+    m_ColumnIndexes(),
+    m_ValidRows(0),
+    m_InvalidRows(0)
+{
+}
+
+PARSER::CsvParser::~CsvParser()
+{
+    if (0 == std::uncaught_exceptions())
+    {
+        // Print the summary.
+        std::cout << '\n' << "Parsed " << m_FileName << ": \n";
+        std::cout << "Valid lines:   " << m_ValidRows << '\n';
+        std::cout << "Invalid lines: " << m_InvalidRows << '\n';
+    }
+}
+
+void PARSER::CsvParser::Parse()
+{
+    // The log may be parsed more than once.
+    m_ValidRows = 0;
+    m_InvalidRows = 0;
+    m_Begin = 0;
+    m_End = 0;
+
+    // The header is the first row.
+    INSTRUMENT::Instrument::LineNumberT rowNumber = 1;
+    bool endOfFile = false;
+    bool header = true;
+    std::vector<SIGNAL::Signal *> vpSignals;
+
+    for (;;)
+    {
+        size_t rowEnd = 0;
+        const RowT row = SplitRow(endOfFile, rowEnd);
+
+        if (RowT::INCOMPLETE == row)
+        {
+            endOfFile = !Fill();
+            continue;
+        }
+
+        if (RowT::END == row)
+        {
+            break;
+        }
+
+        if (header)
+        {
+            if (RowT::VALID != row)
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                              "CSV - Malformed header row in " + m_FileName + ".");
+            }
+            MapHeader();
+            header = false;
+        }
+        else if ((RowT::VALID == row) && CreateSignals(rowNumber, vpSignals))
+        {
+            AddSignals(vpSignals, rowNumber);
+            ++m_ValidRows;
+        }
+        else
+        {
+            if (m_VerboseMode)
+            {
+                std::cout << "Invalid CSV row "
+                          << rowNumber
+                          << ": "
+                          << std::string_view(m_Buffer.data() + m_Begin, rowEnd - m_Begin)
+                          << '\n';
+            }
+            ++m_InvalidRows;
+        }
+
+        m_Begin = rowEnd;
+        ++rowNumber;
+    }
+
+    if (header)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                      "CSV - No header row in " + m_FileName + ".");
+    }
+}
+
+bool PARSER::CsvParser::Fill()
+{
+    // The beginning of the row being split is moved to the front.
+    if (0 != m_Begin)
+    {
+        std::memmove(m_Buffer.data(), m_Buffer.data() + m_Begin, m_End - m_Begin);
+        m_End -= m_Begin;
+        m_Begin = 0;
+    }
+
+    // The row does not fit the buffer.
+    if (m_End == m_Buffer.size())
+    {
+        m_Buffer.resize(2 * m_Buffer.size());
+    }
+
+    m_LogFile.read(m_Buffer.data() + m_End, static_cast<std::streamsize>(m_Buffer.size() - m_End));
+    const size_t read = static_cast<size_t>(m_LogFile.gcount());
+    m_End += read;
+
+    return (0 != read);
+}
+
+PARSER::CsvParser::RowT PARSER::CsvParser::SplitRow(bool endOfFile, size_t &rRowEnd)
+{
+    const char *pData = m_Buffer.data();
+    const char delimiter = m_Scanner.GetDelimiter();
+    size_t position = m_Begin;
+    size_t unquoted = 0;
+
+    if (position == m_End)
+    {
+        return endOfFile ? RowT::END : RowT::INCOMPLETE;
+    }
+
+    m_Fields.clear();
+
+    for (;;)
+    {
+        if ((position < m_End) && ('"' == pData[position]))
+        {
+            // The quoted field ends with the quote not followed by another one.
+            const size_t fieldBegin = ++position;
+            std::string *pUnquoted = nullptr;
+
+            for (;;)
+            {
+                const void *pQuote = std::memchr(pData + position, '"', m_End - position);
+                if (nullptr == pQuote)
+                {
+                    return endOfFile ? SkipRow(m_End, endOfFile, rRowEnd) : RowT::INCOMPLETE;
+                }
+
+                const size_t quote = static_cast<size_t>(static_cast<const char *>(pQuote) - pData);
+                if (((quote + 1) == m_End) && !endOfFile)
+                {
+                    return RowT::INCOMPLETE;
+                }
+
+                if (((quote + 1) < m_End) && ('"' == pData[quote + 1]))
+                {
+                    // The escaped quote. The field is copied without the second quote.
+                    if (nullptr == pUnquoted)
+                    {
+                        if (unquoted == m_Unquoted.size())
+                        {
+                            m_Unquoted.emplace_back();
+                        }
+                        pUnquoted = &m_Unquoted[unquoted++];
+                        pUnquoted->assign(pData + fieldBegin, quote + 1 - fieldBegin);
+                    }
+                    else
+                    {
+                        pUnquoted->append(pData + position, quote + 1 - position);
+                    }
+                    position = quote + 2;
+                    continue;
+                }
+
+                if (nullptr != pUnquoted)
+                {
+                    pUnquoted->append(pData + position, quote - position);
+                    m_Fields.push_back(*pUnquoted);
+                }
+                else
+                {
+                    m_Fields.push_back(std::string_view(pData + fieldBegin, quote - fieldBegin));
+                }
+                position = quote + 1;
+                break;
+            }
+        }
+        else
+        {
+            // The quotes inside the unquoted field are ordinary characters.
+            const size_t fieldBegin = position;
+            for (;;)
+            {
+                position += m_Scanner.Find(pData + position, m_End - position);
+                if ((position < m_End) && ('"' == pData[position]))
+                {
+                    ++position;
+                    continue;
+                }
+                break;
+            }
+            m_Fields.push_back(std::string_view(pData + fieldBegin, position - fieldBegin));
+        }
+
+        if (position == m_End)
+        {
+            if (!endOfFile)
+            {
+                return RowT::INCOMPLETE;
+            }
+            rRowEnd = m_End;
+            return RowT::VALID;
+        }
+
+        const char character = pData[position];
+        if (delimiter == character)
+        {
+            ++position;
+        }
+        else if ('\n' == character)
+        {
+            rRowEnd = position + 1;
+            return RowT::VALID;
+        }
+        else if ('\r' == character)
+        {
+            if (((position + 1) == m_End) && !endOfFile)
+            {
+                return RowT::INCOMPLETE;
+            }
+            rRowEnd = (((position + 1) < m_End) && ('\n' == pData[position + 1])) ? position + 2 : position + 1;
+            return RowT::VALID;
+        }
+        else
+        {
+            // The characters following the closing quote.
+            return SkipRow(position, endOfFile, rRowEnd);
+        }
+    }
+}
+
+PARSER::CsvParser::RowT PARSER::CsvParser::SkipRow(size_t position, bool endOfFile, size_t &rRowEnd) const
+{
+    const void *pLineFeed = std::memchr(m_Buffer.data() + position, '\n', m_End - position);
+
+    if (nullptr != pLineFeed)
+    {
+        rRowEnd = static_cast<size_t>(static_cast<const char *>(pLineFeed) - m_Buffer.data()) + 1;
+        return RowT::INVALID;
+    }
+
+    if (!endOfFile)
+    {
+        return RowT::INCOMPLETE;
+    }
+
+    rRowEnd = m_End;
+    return RowT::INVALID;
+}
+
+void PARSER::CsvParser::MapHeader()
+{
+    // The byte order mark is not a part of the first column name.
+    const std::string_view byteOrderMark("\xEF\xBB\xBF");
+    if ((m_Fields[0].size() >= byteOrderMark.size()) &&
+        (m_Fields[0].substr(0, byteOrderMark.size()) == byteOrderMark))
+    {
+        m_Fields[0].remove_prefix(byteOrderMark.size());
+    }
+
+    m_HeaderColumns = m_Fields.size();
+
+    const auto findColumn = [this](const std::string &rHeader)
+    {
+        for (size_t index = 0; index < m_Fields.size(); ++index)
+        {
+            if (m_Fields[index] == rHeader)
+            {
+                return index;
+            }
+        }
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CSV_COLUMN_NOT_FOUND,
+                                      "CSV - Column not found: " + rHeader);
+    };
+
+    m_TimestampIndex = findColumn(m_rLayout.GetTimestampColumn());
+
+    m_ColumnIndexes.clear();
+    for (const CsvLayout::Column &rColumn : m_rLayout.GetColumns())
+    {
+        m_ColumnIndexes.push_back(findColumn(rColumn.m_Header));
+    }
+}
+
+bool PARSER::CsvParser::CreateSignals(INSTRUMENT::Instrument::LineNumberT rowNumber,
+                                      std::vector<SIGNAL::Signal *> &rvpSignals)
+{
+    if (m_Fields.size() != m_HeaderColumns)
+    {
+        return false;
+    }
+
+    uint64_t timestamp = 0;
+    size_t end = 0;
+    const std::string_view timestampCell = Trim(m_Fields[m_TimestampIndex]);
+    if ((UTILS::ConversionStatus::OK != UTILS::NumberConverter::ConvertDecimal(timestampCell, timestamp, end)) ||
+        (end != timestampCell.size()))
+    {
+        return false;
+    }
+
+    const std::vector<CsvLayout::Column> &rColumns = m_rLayout.GetColumns();
+    bool valid = true;
+
+    for (size_t column = 0; valid && (column < rColumns.size()); ++column)
+    {
+        const std::string_view cell = Trim(m_Fields[m_ColumnIndexes[column]]);
+
+        // The signal does not change in the row.
+        if (cell.empty())
+        {
+            continue;
+        }
+
+        const CsvLayout::Column &rColumn = rColumns[column];
+        if (CsvLayout::ColumnT::VECTOR == rColumn.m_Type)
+        {
+            uint64_t value = 0;
+            const bool hex = (cell.size() > 2) && ('0' == cell[0]) && (('x' == cell[1]) || ('X' == cell[1]));
+
+            // The whole cell must be the number.
+            valid = (UTILS::ConversionStatus::OK == (hex ?
+                                                     UTILS::NumberConverter::ConvertHex(cell, value, end) :
+                                                     UTILS::NumberConverter::ConvertDecimal(cell, value, end))) &&
+                    (end == cell.size());
+            if (valid)
+            {
+                if (SIGNAL::ISignal::IsValueInRange(value, rColumn.m_Size))
+                {
+                    rvpSignals.push_back(new SIGNAL::ISignal(rColumn.m_Name,
+                                                             rColumn.m_Size,
+                                                             timestamp,
+                                                             value,
+                                                             m_SourceHandle));
+                }
+                else
+                {
+                    LOGGER::Logger::GetInstance().LogWarning(EXCEPTION::Warning::INSUFFICIENT_VECTOR_SIZE,
+                                                             "Evaluating " + m_FileName + ".\n" +
+                                                             "Row " + std::to_string(rowNumber) + ", column " +
+                                                             rColumn.m_Header + ".\n" +
+                                                             EXCEPTION::TooSmallVector::GetMessage(value, rColumn.m_Size));
+                }
+            }
+        }
+        else
+        {
+            double value = 0;
+            // The value is printed again, as VCD does not accept every float notation.
+            valid = (UTILS::ConversionStatus::OK == UTILS::NumberConverter::ConvertFloat(cell, value, end)) &&
+                    (end == cell.size()) &&
+                    std::isfinite(value);
+            if (valid)
+            {
+                rvpSignals.push_back(new SIGNAL::FSignal(rColumn.m_Name,
+                                                         timestamp,
+                                                         UTILS::NumberConverter::PrintFloat(value),
+                                                         m_SourceHandle));
+            }
+        }
+    }
+
+    // No signals are created from the invalid row.
+    if (!valid)
+    {
+        for (SIGNAL::Signal *pSignal : rvpSignals)
+        {
+            delete pSignal;
+        }
+        rvpSignals.clear();
+    }
+
+    return valid;
+}
+
+std::string_view PARSER::CsvParser::Trim(std::string_view cell)
+{
+    // The spaces around the values are allowed.
+    while (!cell.empty() && ((' ' == cell.front()) || ('\t' == cell.front())))
+    {
+        cell.remove_prefix(1);
+    }
+    while (!cell.empty() && ((' ' == cell.back()) || ('\t' == cell.back())))
+    {
+        cell.remove_suffix(1);
+    }
+
+    return cell;
+}
@@ -0,0 +1,77 @@
+/// @file common/src/CsvScanner.cpp
+///
+/// The CSV structural characters scanner.
+///
+/// @par Full Description
+/// The scanner finds the characters delimiting the CSV fields and rows.
+/// Sixteen characters are compared at a time if SSE2 is available.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#if defined(__SSE2__) || defined(_M_X64)
+#define CSV_SCANNER_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "CsvScanner.h"
+
+size_t PARSER::CsvScanner::Find(const char *pData, size_t size) const
+{
+    size_t position = 0;
+
+#if defined(CSV_SCANNER_SSE2)
+    const __m128i delimiter = _mm_set1_epi8(m_Delimiter);
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+    const __m128i lineFeed = _mm_set1_epi8('\n');
+
+    // Every structural character of the block sets a bit of the mask.
+    // The block holding one is searched character by character below.
+    for (; (position + sizeof(__m128i)) <= size; position += sizeof(__m128i))
+    {
+        const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + position));
+        const __m128i structural = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(block, delimiter),
+                                                             _mm_cmpeq_epi8(block, quote)),
+                                                _mm_or_si128(_mm_cmpeq_epi8(block, carriageReturn),
+                                                             _mm_cmpeq_epi8(block, lineFeed)));
+        const unsigned int mask = static_cast<unsigned int>(_mm_movemask_epi8(structural));
+
+        if (0 != mask)
+        {
+            break;
+        }
+    }
+#endif
+
+    // The block with the structural character, the tail of the data
+    // or the whole data without SSE2.
+    for (; position < size; ++position)
+    {
+        if (IsStructural(pData[position]))
+        {
+            break;
+        }
+    }
+
+    return position;
+}
@@ -34,7 +34,8 @@
 #include "VcdException.h"
 
 PARSER::DefaultSignalFactory::DefaultSignalFactory() :
-    SignalFactory()
+    // The native vector, real and event lines are mutually exclusive.
+    SignalFactory(true)
 {
     try
     {
@@ -27,21 +27,24 @@
 #include "EventSignalCreator.h"
 #include "EventSignal.h"
 
-SIGNAL::Signal *PARSER::EventSignalCreator::Create(const std::string &rLogLine,
-                                                   INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                                   SIGNAL::SourceRegistry::HandleT sourceHandle) const
+bool PARSER::EventSignalCreator::Create(const std::string &rLogLine,
+                                        INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                        SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                        CreationSink &rSink) const
 {
-    std::smatch result;
+    std::smatch &result = m_Match;
 
     (void)lineNumber;
-    if (true == std::regex_search(rLogLine, result, m_SignalRegEx))
-    {
-        return new SIGNAL::EventSignal(result[2].str(),
-                                       std::stoll(result[1].str()),
-                                       sourceHandle);
-    }
-    else
+    uint64_t timestamp = 0;
+
+    // Timestamps out of range make the line invalid.
+    if ((true == std::regex_search(rLogLine, result, *m_pSignalRegEx)) &&
+        ConvertDecimalGroup(result, 1, timestamp))
     {
-        return nullptr;
+        rSink.AddSignal(new SIGNAL::EventSignal(result[2].str(),
+                                                timestamp,
+                                                sourceHandle));
+        return true;
     }
+    return false;
 }
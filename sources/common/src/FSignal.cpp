@@ -37,6 +37,25 @@ std::string SIGNAL::FSignal::Print() const
     return ('r' + m_Value + ' ' + m_Name);
 }
 
+void SIGNAL::FSignal::Serialize(std::ostream &rOut) const
+{
+    const uint32_t length = static_cast<uint32_t>(m_Value.size());
+
+    rOut.write(reinterpret_cast<const char *>(&length), sizeof(length));
+    rOut.write(m_Value.data(), length);
+}
+
+SIGNAL::Signal *SIGNAL::FSignal::Deserialize(const TIME::Timestamp &rTimestamp, std::istream &rIn) const
+{
+    uint32_t length = 0;
+    rIn.read(reinterpret_cast<char *>(&length), sizeof(length));
+
+    std::string value(length, '\0');
+    rIn.read(&value[0], length);
+
+    return new FSignal(m_Name, rTimestamp, value, m_SourceHandle);
+}
+
 bool SIGNAL::FSignal::EqualTo(Signal const &other) const
 {
     if (FSignal const *p = dynamic_cast<FSignal const *>(&other))
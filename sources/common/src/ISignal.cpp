@@ -29,6 +29,8 @@
 /// IN THE SOFTWARE.
 
 #include <bitset>
+#include <istream>
+#include <ostream>
 
 #include "ISignal.h"
 
@@ -47,7 +49,7 @@ SIGNAL::ISignal::ISignal(const std::string &name,
                                       std::to_string(size) + "-bit size.");
     }
 
-    if ((0 == size) || (value > (std::numeric_limits<uint64_t>::max() >> (64 - size))))
+    if (!IsValueInRange(value, size))
     {
         throw EXCEPTION::TooSmallVector(value, size);
     }
@@ -68,6 +70,19 @@ std::string SIGNAL::ISignal::Footprint() const
     return ('b' + sizeFootprint + ' ' + m_Name);
 }
 
+void SIGNAL::ISignal::Serialize(std::ostream &rOut) const
+{
+    rOut.write(reinterpret_cast<const char *>(&m_Value), sizeof(m_Value));
+}
+
+SIGNAL::Signal *SIGNAL::ISignal::Deserialize(const TIME::Timestamp &rTimestamp, std::istream &rIn) const
+{
+    uint64_t value = 0;
+    rIn.read(reinterpret_cast<char *>(&value), sizeof(value));
+
+    return new ISignal(m_Name, m_Size, rTimestamp, value, m_SourceHandle);
+}
+
 bool SIGNAL::ISignal::EqualTo(Signal const &other) const
 {
     if (ISignal const *p = dynamic_cast<ISignal const *>(&other))
@@ -27,23 +27,33 @@
 #include "ISignalCreator.h"
 #include "ISignal.h"
 
-SIGNAL::Signal *PARSER::ISignalCreator::Create(const std::string &rLogLine,
-                                               INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                               SIGNAL::SourceRegistry::HandleT sourceHandle) const
+bool PARSER::ISignalCreator::Create(const std::string &rLogLine,
+                                    INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                    SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                    CreationSink &rSink) const
 {
-    std::smatch result;
+    std::smatch &result = m_Match;
 
     (void)lineNumber;
-    if (true == std::regex_search(rLogLine, result, m_SignalRegEx))
+    if (true == std::regex_search(rLogLine, result, *m_pSignalRegEx))
     {
-        return new SIGNAL::ISignal(result[2].str(),
-                                   std::stoi(result[4].str()),
-                                   std::stoll(result[1].str()),
-                                   std::stoll(result[3].str()),
-                                   sourceHandle);
-    }
-    else
-    {
-        return nullptr;
+        uint64_t timestamp = 0;
+        uint64_t value = 0;
+        uint64_t size = 0;
+
+        // Numbers out of range make the line invalid.
+        if (ConvertDecimalGroup(result, 1, timestamp) &&
+            ConvertDecimalGroup(result, 3, value) &&
+            ConvertDecimalGroup(result, 4, size))
+        {
+            CreateVector(result[2].str(),
+                         static_cast<size_t>(size),
+                         timestamp,
+                         value,
+                         sourceHandle,
+                         rSink);
+            return true;
+        }
     }
+    return false;
 }
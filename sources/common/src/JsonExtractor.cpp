@@ -0,0 +1,535 @@
+/// @file common/src/JsonExtractor.cpp
+///
+/// The JSON values extractor.
+///
+/// @par Full Description
+/// The extractor finds the values of the given paths in the JSON text
+/// without building the document tree.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <cstring>
+
+#include "JsonExtractor.h"
+#include "NumberConverter.h"
+#include "VcdException.h"
+
+PARSER::JsonExtractor::JsonExtractor() :
+    m_Nodes(1, Node{"", NO_INDEX, 0, {}}),
+    m_Text(),
+    m_Values(1),
+    m_Unescaped(1),
+    m_Missing(0)
+{
+}
+
+size_t PARSER::JsonExtractor::AddPath(const std::string &rPath)
+{
+    size_t node = 0;
+    size_t start = 0;
+
+    for (;;)
+    {
+        const size_t end = std::min(rPath.find('.', start), rPath.size());
+        const std::string key = rPath.substr(start, end - start);
+
+        if (key.empty())
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_JSON_DESCRIPTION,
+                                          "XML - Invalid JSON path: '" + rPath + "'");
+        }
+
+        size_t child = FindKey(node, key);
+        if (NO_NODE == child)
+        {
+            // The numeric keys match the array elements too.
+            uint64_t index = 0;
+            const bool isIndex = (std::string::npos == key.find_first_not_of("0123456789")) &&
+                                 (UTILS::ConversionStatus::OK == UTILS::NumberConverter::ConvertDecimal(key, index));
+
+            m_Nodes.push_back(Node{key, isIndex ? static_cast<size_t>(index) : NO_INDEX, 0, {}});
+            child = m_Nodes.size() - 1;
+            m_Nodes[node].m_Children.push_back(child);
+        }
+
+        node = child;
+
+        if (end == rPath.size())
+        {
+            break;
+        }
+        start = end + 1;
+    }
+
+    // The same path gives the same value.
+    if (0 == m_Nodes[node].m_Value)
+    {
+        m_Values.emplace_back();
+        m_Unescaped.emplace_back();
+        m_Nodes[node].m_Value = m_Values.size() - 1;
+    }
+
+    return m_Nodes[node].m_Value;
+}
+
+bool PARSER::JsonExtractor::Extract(std::string_view text) const
+{
+    m_Text = text;
+    m_Values[0] = text;
+
+    for (size_t value = 1; value < m_Values.size(); ++value)
+    {
+        m_Values[value] = std::string_view();
+    }
+    m_Missing = m_Values.size() - 1;
+
+    if (NO_POSITION == ParseValue(SkipWhitespaces(0), 0, 0))
+    {
+        return false;
+    }
+
+    return (0 == m_Missing);
+}
+
+size_t PARSER::JsonExtractor::ParseValue(size_t position, size_t node, size_t depth) const
+{
+    if (position >= m_Text.size())
+    {
+        return NO_POSITION;
+    }
+
+    const char character = m_Text[position];
+
+    if ('"' == character)
+    {
+        bool escaped = false;
+        const size_t end = FindStringEnd(position + 1, escaped);
+
+        if ((NO_POSITION == end) ||
+            ((NO_NODE != node) && !StoreValue(node, m_Text.substr(position + 1, end - position - 1), escaped)))
+        {
+            return NO_POSITION;
+        }
+        return end + 1;
+    }
+
+    if (('{' == character) || ('[' == character))
+    {
+        size_t end = NO_POSITION;
+
+        // Only the containers holding the paths are parsed.
+        if ((NO_NODE == node) || m_Nodes[node].m_Children.empty())
+        {
+            end = SkipContainer(position + 1);
+        }
+        else if ('{' == character)
+        {
+            end = ParseObject(position + 1, node, depth + 1);
+        }
+        else
+        {
+            end = ParseArray(position + 1, node, depth + 1);
+        }
+
+        if ((NO_POSITION == end) ||
+            ((NO_NODE != node) && !StoreValue(node, m_Text.substr(position, end - position), false)))
+        {
+            return NO_POSITION;
+        }
+        return end;
+    }
+
+    // The numbers and the literals end at the structural characters.
+    size_t end = position;
+    while ((end < m_Text.size()) && (nullptr == std::strchr(",}] \t\r\n", m_Text[end])))
+    {
+        ++end;
+    }
+
+    if ((end == position) ||
+        ((NO_NODE != node) && !StoreValue(node, m_Text.substr(position, end - position), false)))
+    {
+        return NO_POSITION;
+    }
+    return end;
+}
+
+size_t PARSER::JsonExtractor::ParseObject(size_t position, size_t node, size_t depth) const
+{
+    if (depth > MAX_DEPTH)
+    {
+        return NO_POSITION;
+    }
+
+    position = SkipWhitespaces(position);
+    if ((position < m_Text.size()) && ('}' == m_Text[position]))
+    {
+        return position + 1;
+    }
+
+    for (;;)
+    {
+        if ((position >= m_Text.size()) || ('"' != m_Text[position]))
+        {
+            return NO_POSITION;
+        }
+
+        // The keys are compared as written.
+        bool escaped = false;
+        const size_t keyEnd = FindStringEnd(position + 1, escaped);
+        if (NO_POSITION == keyEnd)
+        {
+            return NO_POSITION;
+        }
+
+        const size_t child = FindKey(node, m_Text.substr(position + 1, keyEnd - position - 1));
+
+        position = SkipWhitespaces(keyEnd + 1);
+        if ((position >= m_Text.size()) || (':' != m_Text[position]))
+        {
+            return NO_POSITION;
+        }
+
+        position = ParseValue(SkipWhitespaces(position + 1), child, depth);
+        if ((NO_POSITION == position) || (0 == m_Missing))
+        {
+            return position;
+        }
+
+        position = SkipWhitespaces(position);
+        if (position >= m_Text.size())
+        {
+            return NO_POSITION;
+        }
+        if ('}' == m_Text[position])
+        {
+            return position + 1;
+        }
+        if (',' != m_Text[position])
+        {
+            return NO_POSITION;
+        }
+        position = SkipWhitespaces(position + 1);
+    }
+}
+
+size_t PARSER::JsonExtractor::ParseArray(size_t position, size_t node, size_t depth) const
+{
+    if (depth > MAX_DEPTH)
+    {
+        return NO_POSITION;
+    }
+
+    position = SkipWhitespaces(position);
+    if ((position < m_Text.size()) && (']' == m_Text[position]))
+    {
+        return position + 1;
+    }
+
+    for (size_t index = 0; ; ++index)
+    {
+        position = ParseValue(position, FindIndex(node, index), depth);
+        if ((NO_POSITION == position) || (0 == m_Missing))
+        {
+            return position;
+        }
+
+        position = SkipWhitespaces(position);
+        if (position >= m_Text.size())
+        {
+            return NO_POSITION;
+        }
+        if (']' == m_Text[position])
+        {
+            return position + 1;
+        }
+        if (',' != m_Text[position])
+        {
+            return NO_POSITION;
+        }
+        position = SkipWhitespaces(position + 1);
+    }
+}
+
+size_t PARSER::JsonExtractor::FindStringEnd(size_t position, bool &rEscaped) const
+{
+    const size_t start = position;
+
+    for (;;)
+    {
+        const void *pQuote = std::memchr(m_Text.data() + position, '"', m_Text.size() - position);
+        if (nullptr == pQuote)
+        {
+            return NO_POSITION;
+        }
+
+        const size_t quote = static_cast<size_t>(static_cast<const char *>(pQuote) - m_Text.data());
+
+        // The quote is escaped if preceded by an odd number of backslashes.
+        size_t backslashes = 0;
+        while (((quote - backslashes) > start) && ('\\' == m_Text[quote - backslashes - 1]))
+        {
+            ++backslashes;
+        }
+
+        if (0 == (backslashes % 2))
+        {
+            rEscaped = (nullptr != std::memchr(m_Text.data() + start, '\\', quote - start));
+            return quote;
+        }
+
+        position = quote + 1;
+    }
+}
+
+size_t PARSER::JsonExtractor::SkipContainer(size_t position) const
+{
+    size_t depth = 1;
+
+    while (position < m_Text.size())
+    {
+        const char character = m_Text[position];
+
+        if ('"' == character)
+        {
+            bool escaped = false;
+            position = FindStringEnd(position + 1, escaped);
+            if (NO_POSITION == position)
+            {
+                return NO_POSITION;
+            }
+        }
+        else if (('{' == character) || ('[' == character))
+        {
+            ++depth;
+        }
+        else if (('}' == character) || (']' == character))
+        {
+            if (0 == --depth)
+            {
+                return position + 1;
+            }
+        }
+
+        ++position;
+    }
+
+    return NO_POSITION;
+}
+
+size_t PARSER::JsonExtractor::SkipWhitespaces(size_t position) const
+{
+    while ((position < m_Text.size()) &&
+           ((' ' == m_Text[position]) ||
+            ('\t' == m_Text[position]) ||
+            ('\r' == m_Text[position]) ||
+            ('\n' == m_Text[position])))
+    {
+        ++position;
+    }
+
+    return position;
+}
+
+bool PARSER::JsonExtractor::StoreValue(size_t node, std::string_view value, bool escaped) const
+{
+    const size_t index = m_Nodes[node].m_Value;
+
+    // The first occurrence of the duplicated key is used.
+    if ((0 == index) || (nullptr != m_Values[index].data()))
+    {
+        return true;
+    }
+
+    if (escaped)
+    {
+        if (!Unescape(value, m_Unescaped[index]))
+        {
+            return false;
+        }
+        m_Values[index] = m_Unescaped[index];
+    }
+    else
+    {
+        m_Values[index] = value;
+    }
+
+    --m_Missing;
+    return true;
+}
+
+bool PARSER::JsonExtractor::Unescape(std::string_view value, std::string &rUnescaped)
+{
+    // Reads the four hexadecimal digits of the \u escape sequence.
+    const auto readCodeUnit = [value](size_t position, uint32_t &rCodeUnit)
+    {
+        if ((position + 4) > value.size())
+        {
+            return false;
+        }
+
+        rCodeUnit = 0;
+        for (size_t digit = position; digit < (position + 4); ++digit)
+        {
+            const char character = value[digit];
+            uint32_t nibble = 0;
+
+            if ((character >= '0') && (character <= '9'))
+            {
+                nibble = static_cast<uint32_t>(character - '0');
+            }
+            else if ((character >= 'a') && (character <= 'f'))
+            {
+                nibble = static_cast<uint32_t>(character - 'a' + 10);
+            }
+            else if ((character >= 'A') && (character <= 'F'))
+            {
+                nibble = static_cast<uint32_t>(character - 'A' + 10);
+            }
+            else
+            {
+                return false;
+            }
+            rCodeUnit = (rCodeUnit << 4) | nibble;
+        }
+        return true;
+    };
+
+    rUnescaped.clear();
+
+    for (size_t position = 0; position < value.size(); ++position)
+    {
+        if ('\\' != value[position])
+        {
+            rUnescaped.push_back(value[position]);
+            continue;
+        }
+
+        if (++position == value.size())
+        {
+            return false;
+        }
+
+        switch (value[position])
+        {
+            case '"':
+            case '\\':
+            case '/':
+                rUnescaped.push_back(value[position]);
+                break;
+            case 'b':
+                rUnescaped.push_back('\b');
+                break;
+            case 'f':
+                rUnescaped.push_back('\f');
+                break;
+            case 'n':
+                rUnescaped.push_back('\n');
+                break;
+            case 'r':
+                rUnescaped.push_back('\r');
+                break;
+            case 't':
+                rUnescaped.push_back('\t');
+                break;
+            case 'u':
+            {
+                uint32_t codePoint = 0;
+                if (!readCodeUnit(position + 1, codePoint))
+                {
+                    return false;
+                }
+                position += 4;
+
+                // The surrogate pair.
+                uint32_t lowSurrogate = 0;
+                if ((codePoint >= 0xD800U) && (codePoint <= 0xDBFFU) &&
+                    ((position + 2) < value.size()) &&
+                    ('\\' == value[position + 1]) &&
+                    ('u' == value[position + 2]) &&
+                    readCodeUnit(position + 3, lowSurrogate) &&
+                    (lowSurrogate >= 0xDC00U) && (lowSurrogate <= 0xDFFFU))
+                {
+                    codePoint = 0x10000U + ((codePoint - 0xD800U) << 10) + (lowSurrogate - 0xDC00U);
+                    position += 6;
+                }
+
+                // UTF-8 encoding.
+                if (codePoint < 0x80U)
+                {
+                    rUnescaped.push_back(static_cast<char>(codePoint));
+                }
+                else if (codePoint < 0x800U)
+                {
+                    rUnescaped.push_back(static_cast<char>(0xC0U | (codePoint >> 6)));
+                    rUnescaped.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+                }
+                else if (codePoint < 0x10000U)
+                {
+                    rUnescaped.push_back(static_cast<char>(0xE0U | (codePoint >> 12)));
+                    rUnescaped.push_back(static_cast<char>(0x80U | ((codePoint >> 6) & 0x3FU)));
+                    rUnescaped.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+                }
+                else
+                {
+                    rUnescaped.push_back(static_cast<char>(0xF0U | (codePoint >> 18)));
+                    rUnescaped.push_back(static_cast<char>(0x80U | ((codePoint >> 12) & 0x3FU)));
+                    rUnescaped.push_back(static_cast<char>(0x80U | ((codePoint >> 6) & 0x3FU)));
+                    rUnescaped.push_back(static_cast<char>(0x80U | (codePoint & 0x3FU)));
+                }
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+
+    return true;
+}
+
+size_t PARSER::JsonExtractor::FindKey(size_t node, std::string_view key) const
+{
+    for (const size_t child : m_Nodes[node].m_Children)
+    {
+        if (m_Nodes[child].m_Key == key)
+        {
+            return child;
+        }
+    }
+
+    return NO_NODE;
+}
+
+size_t PARSER::JsonExtractor::FindIndex(size_t node, size_t index) const
+{
+    for (const size_t child : m_Nodes[node].m_Children)
+    {
+        if (m_Nodes[child].m_Index == index)
+        {
+            return child;
+        }
+    }
+
+    return NO_NODE;
+}
@@ -60,9 +60,93 @@ void PARSER::LogParser::TerminateInstruments()
     }
 }
 
+void PARSER::LogParser::AddSignals(std::vector<SIGNAL::Signal *> &rvpSignals,
+                                   INSTRUMENT::Instrument::LineNumberT lineNumber)
+{
+    while (!rvpSignals.empty())
+    {
+        SIGNAL::Signal *pSignal = rvpSignals.back();
+        rvpSignals.pop_back();
+
+        // The database may pass the signal over to a consumer.
+        for (auto instrument : m_vpInstruments)
+        {
+            instrument->Notify(lineNumber, *pSignal);
+        }
+
+        try
+        {
+            m_pSignalDb->Add(pSignal);
+        }
+        catch (const EXCEPTION::VcdException &rException)
+        {
+            delete pSignal;
+            while (!rvpSignals.empty())
+            {
+                delete rvpSignals.back();
+                rvpSignals.pop_back();
+            }
+            if ((EXCEPTION::Error::INCONSISTENT_SIGNAL == rException.GetId()) ||
+                (EXCEPTION::Error::UNSORTED_SIGNAL == rException.GetId()) ||
+                (EXCEPTION::Error::SIGNAL_BEYOND_REORDER_WINDOW == rException.GetId()))
+            {
+                throw EXCEPTION::VcdException(rException.GetId(), std::string(rException.what()) +
+                                              " At line " + std::to_string(lineNumber) + ".");
+            }
+            else
+            {
+                throw;
+            }
+        }
+    }
+}
+
 void PARSER::LogParser::Execute()
 {
     Parse();
     TerminateInstruments();
 }
 
+void PARSER::LogParser::Stream(SIGNAL::SignalConsumer &rConsumer)
+{
+    // The signals consumer of the first pass.
+    class DeclarationsCollector : public SIGNAL::SignalConsumer
+    {
+        public:
+
+            /// Drops the signal. Its declaration has been already collected.
+            virtual void Consume(SIGNAL::Signal *pSignal)
+            {
+                delete pSignal;
+            }
+    };
+
+    DeclarationsCollector collector;
+    const bool verboseMode = m_VerboseMode;
+    const bool dropUnchanged = m_pSignalDb->IsDroppingUnchanged();
+
+    // Invalid lines shall be reported once.
+    m_VerboseMode = false;
+
+    // The last values shall be tracked from the beginning of the second pass.
+    m_pSignalDb->SetUnchangedDropping(false);
+
+    m_pSignalDb->SetConsumer(&collector);
+    Parse();
+    m_VerboseMode = verboseMode;
+    m_pSignalDb->SetUnchangedDropping(dropUnchanged);
+
+    m_LogFile.clear();
+    if (!m_LogFile.seekg(0))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE,
+                                      "Rewinding file '" + m_FileName + "' failed.");
+    }
+
+    m_pSignalDb->SetConsumer(&rConsumer);
+    rConsumer.Begin();
+    Parse();
+    rConsumer.End();
+    m_pSignalDb->SetConsumer(nullptr);
+}
+
@@ -0,0 +1,125 @@
+/// @file common/src/MappedFile.cpp
+///
+/// The read-only memory-mapped file.
+///
+/// @par Full Description
+/// The file contents are accessed in place without being copied.
+///
+/// @ingroup Utils
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "MappedFile.h"
+#include "VcdException.h"
+
+UTILS::MappedFile::MappedFile(const std::string &rFileName) :
+    m_pData(nullptr),
+    m_Size(0)
+{
+    const std::string error = "Mapping file '" + rFileName + "' failed, it either doesn't exist or is inaccessible.";
+
+#if defined(_WIN32)
+    const HANDLE file = CreateFileA(rFileName.c_str(),
+                                    GENERIC_READ,
+                                    FILE_SHARE_READ,
+                                    nullptr,
+                                    OPEN_EXISTING,
+                                    FILE_FLAG_SEQUENTIAL_SCAN,
+                                    nullptr);
+    if (INVALID_HANDLE_VALUE == file)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE, error);
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size))
+    {
+        CloseHandle(file);
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE, error);
+    }
+    m_Size = static_cast<size_t>(size.QuadPart);
+
+    // The empty file cannot be mapped.
+    if (0 != m_Size)
+    {
+        const HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (nullptr != mapping)
+        {
+            m_pData = static_cast<const unsigned char *>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    const int file = open(rFileName.c_str(), O_RDONLY);
+    if (-1 == file)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE, error);
+    }
+
+    struct stat status;
+    if (0 != fstat(file, &status))
+    {
+        close(file);
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE, error);
+    }
+    m_Size = static_cast<size_t>(status.st_size);
+
+    // The empty file cannot be mapped.
+    if (0 != m_Size)
+    {
+        void *pMapping = mmap(nullptr, m_Size, PROT_READ, MAP_PRIVATE, file, 0);
+        if (MAP_FAILED != pMapping)
+        {
+            // The file is read once from the beginning to the end.
+            madvise(pMapping, m_Size, MADV_SEQUENTIAL);
+            m_pData = static_cast<const unsigned char *>(pMapping);
+        }
+    }
+    close(file);
+#endif
+
+    if ((0 != m_Size) && (nullptr == m_pData))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE, error);
+    }
+}
+
+UTILS::MappedFile::~MappedFile()
+{
+    if (nullptr != m_pData)
+    {
+#if defined(_WIN32)
+        UnmapViewOfFile(m_pData);
+#else
+        munmap(const_cast<unsigned char *>(m_pData), m_Size);
+#endif
+    }
+}
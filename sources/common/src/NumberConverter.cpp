@@ -0,0 +1,339 @@
+/// @file common/src/NumberConverter.cpp
+///
+/// The number converter.
+///
+/// @par Full Description
+/// The conversion of decimal, hexadecimal and float strings into numbers.
+/// The errors are reported with status codes rather than exceptions.
+///
+/// @ingroup Utils
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cerrno>
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#include "NumberConverter.h"
+
+#if defined(_MSC_VER) || (defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__))
+/// The chunk conversions assume the little-endian byte order.
+#define NUMBER_CONVERTER_CHUNKS
+#endif
+
+UTILS::ConversionStatus UTILS::NumberConverter::ConvertDecimal(std::string_view text, uint64_t &rValue)
+{
+    size_t end = 0;
+    return ConvertDecimal(text, rValue, end);
+}
+
+UTILS::ConversionStatus UTILS::NumberConverter::ConvertDecimal(std::string_view text, uint64_t &rValue, size_t &rEnd)
+{
+    bool negative = false;
+    size_t position = SkipSign(text, negative);
+    const size_t firstDigit = position;
+    uint64_t value = 0;
+
+#if defined(NUMBER_CONVERTER_CHUNKS)
+    while (((text.size() - position) >= CHUNK_DIGITS) && (value <= MAX_BEFORE_DECIMAL_CHUNK))
+    {
+        const uint64_t chunk = LoadChunk(text, position);
+        if (!IsDecimalChunk(chunk))
+        {
+            break;
+        }
+        value = (value * 100000000U) + ConvertDecimalChunk(chunk);
+        position += CHUNK_DIGITS;
+    }
+#endif
+
+    while ((position < text.size()) && IsDigit(text[position]))
+    {
+        const uint64_t digit = static_cast<uint64_t>(text[position] - '0');
+        if (value > ((std::numeric_limits<uint64_t>::max() - digit) / 10U))
+        {
+            return ConversionStatus::OUT_OF_RANGE;
+        }
+        value = (value * 10U) + digit;
+        ++position;
+    }
+
+    if (position == firstDigit)
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    rValue = negative ? (0U - value) : value;
+    rEnd = position;
+    return ConversionStatus::OK;
+}
+
+UTILS::ConversionStatus UTILS::NumberConverter::ConvertHex(std::string_view text, uint64_t &rValue)
+{
+    size_t end = 0;
+    return ConvertHex(text, rValue, end);
+}
+
+UTILS::ConversionStatus UTILS::NumberConverter::ConvertHex(std::string_view text, uint64_t &rValue, size_t &rEnd)
+{
+    bool negative = false;
+    size_t position = SkipSign(text, negative);
+
+    // The prefix is skipped only if followed by a digit. Otherwise '0' is the number.
+    if (((text.size() - position) > 2) &&
+        ('0' == text[position]) &&
+        (('x' == text[position + 1]) || ('X' == text[position + 1])) &&
+        (GetHexDigit(text[position + 2]) < 16U))
+    {
+        position += 2;
+    }
+
+    const size_t firstDigit = position;
+    uint64_t value = 0;
+
+#if defined(NUMBER_CONVERTER_CHUNKS)
+    while (((text.size() - position) >= CHUNK_DIGITS) && (0U == (value >> 32)))
+    {
+        const uint64_t chunk = LoadChunk(text, position);
+        if (!IsHexChunk(chunk))
+        {
+            break;
+        }
+        value = (value << 32) | ConvertHexChunk(chunk);
+        position += CHUNK_DIGITS;
+    }
+#endif
+
+    while (position < text.size())
+    {
+        const uint32_t digit = GetHexDigit(text[position]);
+        if (digit >= 16U)
+        {
+            break;
+        }
+        if (0U != (value >> 60))
+        {
+            return ConversionStatus::OUT_OF_RANGE;
+        }
+        value = (value << 4) | digit;
+        ++position;
+    }
+
+    if (position == firstDigit)
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    rValue = negative ? (0U - value) : value;
+    rEnd = position;
+    return ConversionStatus::OK;
+}
+
+UTILS::ConversionStatus UTILS::NumberConverter::ConvertFloat(std::string_view text, double &rValue)
+{
+    size_t end = 0;
+    return ConvertFloat(text, rValue, end);
+}
+
+UTILS::ConversionStatus UTILS::NumberConverter::ConvertFloat(std::string_view text, double &rValue, size_t &rEnd)
+{
+    bool negative = false;
+    size_t position = SkipSign(text, negative);
+
+    // Only one sign is allowed.
+    if ((position < text.size()) && (('+' == text[position]) || ('-' == text[position])))
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    double value = 0.0;
+
+#if defined(__cpp_lib_to_chars)
+    std::chars_format format = std::chars_format::general;
+
+    if (((text.size() - position) > 2) &&
+        ('0' == text[position]) &&
+        (('x' == text[position + 1]) || ('X' == text[position + 1])) &&
+        ((GetHexDigit(text[position + 2]) < 16U) || ('.' == text[position + 2])))
+    {
+        position += 2;
+        format = std::chars_format::hex;
+    }
+
+    const std::from_chars_result result = std::from_chars(text.data() + position,
+                                                          text.data() + text.size(),
+                                                          value,
+                                                          format);
+
+    if (std::errc::invalid_argument == result.ec)
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    if (std::errc::result_out_of_range == result.ec)
+    {
+        return ConversionStatus::OUT_OF_RANGE;
+    }
+
+    rEnd = static_cast<size_t>(result.ptr - text.data());
+#else
+    // The library cannot convert floats from a view.
+    const std::string string(text.substr(position));
+    char *pEnd = nullptr;
+
+    errno = 0;
+    value = std::strtod(string.c_str(), &pEnd);
+
+    if (pEnd == string.c_str())
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    if (ERANGE == errno)
+    {
+        return ConversionStatus::OUT_OF_RANGE;
+    }
+
+    rEnd = position + static_cast<size_t>(pEnd - string.c_str());
+#endif
+
+    rValue = negative ? -value : value;
+    return ConversionStatus::OK;
+}
+
+std::string UTILS::NumberConverter::PrintFloat(double value, bool singlePrecision)
+{
+    char text[32];
+
+#if defined(__cpp_lib_to_chars)
+    const std::to_chars_result result = singlePrecision ?
+                                        std::to_chars(text, text + sizeof(text), static_cast<float>(value)) :
+                                        std::to_chars(text, text + sizeof(text), value);
+
+    return std::string(text, result.ptr);
+#else
+    // The number of digits needed to reproduce any value of the type.
+    const int length = singlePrecision ?
+                       std::snprintf(text, sizeof(text), "%.9g", static_cast<double>(static_cast<float>(value))) :
+                       std::snprintf(text, sizeof(text), "%.17g", value);
+
+    return std::string(text, static_cast<size_t>(length));
+#endif
+}
+
+size_t UTILS::NumberConverter::SkipSign(std::string_view text, bool &rNegative)
+{
+    size_t position = 0;
+
+    while ((position < text.size()) &&
+           ((' ' == text[position]) || (('\t' <= text[position]) && ('\r' >= text[position]))))
+    {
+        ++position;
+    }
+
+    rNegative = false;
+    if ((position < text.size()) && (('+' == text[position]) || ('-' == text[position])))
+    {
+        rNegative = ('-' == text[position]);
+        ++position;
+    }
+
+    return position;
+}
+
+uint32_t UTILS::NumberConverter::GetHexDigit(char character)
+{
+    if (IsDigit(character))
+    {
+        return static_cast<uint32_t>(character - '0');
+    }
+
+    // Lowercase letters.
+    const char letter = static_cast<char>(character | 0x20);
+    if ((letter >= 'a') && (letter <= 'f'))
+    {
+        return static_cast<uint32_t>(letter - 'a') + 10U;
+    }
+
+    return 16U;
+}
+
+uint64_t UTILS::NumberConverter::LoadChunk(std::string_view text, size_t position)
+{
+    uint64_t chunk = 0;
+    std::memcpy(&chunk, text.data() + position, sizeof(chunk));
+    return chunk;
+}
+
+bool UTILS::NumberConverter::IsDecimalChunk(uint64_t chunk)
+{
+    // Every byte must be 0x30-0x39: the high nibble is 3 and adding 6 does not carry into it.
+    return (((chunk & 0xF0F0F0F0F0F0F0F0U) |
+             (((chunk + 0x0606060606060606U) & 0xF0F0F0F0F0F0F0F0U) >> 4)) == 0x3333333333333333U);
+}
+
+uint64_t UTILS::NumberConverter::ConvertDecimalChunk(uint64_t chunk)
+{
+    // The first character is the least significant byte.
+    chunk -= 0x3030303030303030U;
+
+    // Pairs of digits.
+    chunk = (chunk * 10U) + (chunk >> 8);
+
+    // Two groups of four digits combined into the final value.
+    return (((chunk & 0x000000FF000000FFU) * (100U + (1000000ULL << 32))) +
+            (((chunk >> 16) & 0x000000FF000000FFU) * (1U + (10000ULL << 32)))) >> 32;
+}
+
+bool UTILS::NumberConverter::IsHexChunk(uint64_t chunk)
+{
+    const uint64_t ONES = 0x0101010101010101U;
+    const uint64_t HIGH_BITS = 0x8080808080808080U;
+
+    if (0U != (chunk & HIGH_BITS))
+    {
+        return false;
+    }
+
+    // The high bit of a byte is set if the byte is within the range.
+    const uint64_t lower = chunk | (0x20U * ONES);
+    const uint64_t digits = (chunk + ((0x80U - '0') * ONES)) & ~(chunk + ((0x7FU - '9') * ONES));
+    const uint64_t letters = (lower + ((0x80U - 'a') * ONES)) & ~(lower + ((0x7FU - 'f') * ONES));
+
+    return ((digits | letters) & HIGH_BITS) == HIGH_BITS;
+}
+
+uint64_t UTILS::NumberConverter::ConvertHexChunk(uint64_t chunk)
+{
+    // Nibble values: letters have the bit 6 set and need 9 added.
+    uint64_t value = (chunk & 0x0F0F0F0F0F0F0F0FU) + (9U * ((chunk >> 6) & 0x0101010101010101U));
+
+    // The first character is the least significant byte, so each merge puts
+    // the lower half in front of the higher one.
+    value = ((value & 0x000F000F000F000FU) << 4) | ((value >> 8) & 0x000F000F000F000FU);
+    value = ((value & 0x000000FF000000FFU) << 8) | ((value >> 16) & 0x000000FF000000FFU);
+    value = ((value & 0x000000000000FFFFU) << 16) | ((value >> 32) & 0x000000000000FFFFU);
+
+    return value;
+}
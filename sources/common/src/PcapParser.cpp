@@ -0,0 +1,550 @@
+/// @file common/src/PcapParser.cpp
+///
+/// The packet capture log parser.
+///
+/// @par Full Description
+/// The parser creates the signals from the records carried by the UDP
+/// datagrams of the pcap and pcapng captures.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <iostream>
+#include <limits>
+
+#include "PcapParser.h"
+#include "MappedFile.h"
+#include "Logger.h"
+#include "TimeUnit.h"
+#include "VcdException.h"
+
+PARSER::PcapParser::PcapParser(const std::string &rFilename,
+                               const std::string &rTimeBase,
+                               SIGNAL::SourceRegistry &rSourceRegistry,
+                               const BinaryLayout &rLayout,
+                               bool verboseMode) :
+    LogParser(rFilename, rTimeBase, rSourceRegistry, verboseMode),
+    m_rLayout(rLayout),
+    m_TimeBaseDigits(static_cast<uint32_t>(3 * TIME::Unit::GetTimeUnitIndex(rTimeBase))),
+    m_Started(false),
+    m_StartTime(0),
+    m_vpSignals(),
+    m_Records(0),
+    m_ValidRecords(0),
+    m_InvalidRecords(0)
+{
+}
+
+PARSER::PcapParser::~PcapParser()
+{
+    if (0 == std::uncaught_exceptions())
+    {
+        // Print the summary.
+        std::cout << '\n' << "Parsed " << m_FileName << ": \n";
+        std::cout << "Valid lines:   " << m_ValidRecords << '\n';
+        std::cout << "Invalid lines: " << m_InvalidRecords << '\n';
+    }
+}
+
+void PARSER::PcapParser::Parse()
+{
+    // The log may be parsed more than once.
+    m_Started = false;
+    m_Records = 0;
+    m_ValidRecords = 0;
+    m_InvalidRecords = 0;
+
+    const UTILS::MappedFile capture(m_FileName);
+
+    if (capture.GetSize() >= 4)
+    {
+        const uint32_t magic = Read32(capture.GetData(), false);
+
+        if ((0xA1B2C3D4U == magic) || (0xD4C3B2A1U == magic) ||
+            (0xA1B23C4DU == magic) || (0x4D3CB2A1U == magic))
+        {
+            ParsePcap(capture.GetData(), capture.GetSize());
+            return;
+        }
+
+        if (0x0A0D0D0AU == magic)
+        {
+            ParsePcapng(capture.GetData(), capture.GetSize());
+            return;
+        }
+    }
+
+    throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                  "Pcap - Unknown capture format of " + m_FileName + ".");
+}
+
+void PARSER::PcapParser::ParsePcap(const unsigned char *pData, size_t size)
+{
+    const size_t FILE_HEADER_SIZE = 24;
+    const size_t PACKET_HEADER_SIZE = 16;
+
+    if (size < FILE_HEADER_SIZE)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                      "Pcap - Truncated file header of " + m_FileName + ".");
+    }
+
+    // The magic number gives the byte order and the timestamp resolution.
+    const uint32_t magic = Read32(pData, false);
+    const bool bigEndian = ((0xD4C3B2A1U == magic) || (0x4D3CB2A1U == magic));
+    const bool nanoseconds = ((0xA1B23C4DU == magic) || (0x4D3CB2A1U == magic));
+    const Interface interface{Read32(pData + 20, bigEndian) & 0xFFFFU, nanoseconds ? 9U : 6U};
+    const uint64_t ticksPerSecond = nanoseconds ? 1000000000U : 1000000U;
+
+    size_t position = FILE_HEADER_SIZE;
+    while (position < size)
+    {
+        if ((size - position) < PACKET_HEADER_SIZE)
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                          "Pcap - Truncated packet header in " + m_FileName + ".");
+        }
+
+        const unsigned char *pHeader = pData + position;
+        const uint64_t ticks = Read32(pHeader, bigEndian) * ticksPerSecond + Read32(pHeader + 4, bigEndian);
+        const size_t capturedSize = Read32(pHeader + 8, bigEndian);
+
+        position += PACKET_HEADER_SIZE;
+        if ((size - position) < capturedSize)
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                          "Pcap - Truncated packet in " + m_FileName + ".");
+        }
+
+        ParsePacket(pData + position, capturedSize, interface, ticks);
+        position += capturedSize;
+    }
+}
+
+void PARSER::PcapParser::ParsePcapng(const unsigned char *pData, size_t size)
+{
+    const uint32_t SECTION_HEADER_BLOCK = 0x0A0D0D0AU;
+    const uint32_t INTERFACE_DESCRIPTION_BLOCK = 1U;
+    const uint32_t ENHANCED_PACKET_BLOCK = 6U;
+    const size_t MIN_BLOCK_SIZE = 12;
+
+    // The byte order and the interfaces are given by every section.
+    bool bigEndian = false;
+    std::vector<Interface> interfaces;
+
+    size_t position = 0;
+    while (position < size)
+    {
+        if ((size - position) < MIN_BLOCK_SIZE)
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                          "Pcap - Truncated block in " + m_FileName + ".");
+        }
+
+        const unsigned char *pBlock = pData + position;
+        const uint32_t type = Read32(pBlock, bigEndian);
+
+        if (SECTION_HEADER_BLOCK == type)
+        {
+            if ((size - position) < 16)
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                              "Pcap - Truncated section header in " + m_FileName + ".");
+            }
+            bigEndian = (0x1A2B3C4DU == Read32(pBlock + 8, true));
+            interfaces.clear();
+        }
+
+        const size_t blockSize = Read32(pBlock + 4, bigEndian);
+        if ((blockSize < MIN_BLOCK_SIZE) || (0 != (blockSize % 4)) || (blockSize > (size - position)))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                          "Pcap - Invalid block size in " + m_FileName + ".");
+        }
+
+        // The block body is followed by the repeated block size.
+        const unsigned char *pBody = pBlock + 8;
+        const size_t bodySize = blockSize - MIN_BLOCK_SIZE;
+
+        if ((INTERFACE_DESCRIPTION_BLOCK == type) && (bodySize >= 8))
+        {
+            // The timestamps are in microseconds by default.
+            Interface interface{Read16(pBody, bigEndian), 6U};
+            ParseInterfaceOptions(pBody + 8, bodySize - 8, bigEndian, interface);
+            interfaces.push_back(interface);
+        }
+        else if ((ENHANCED_PACKET_BLOCK == type) && (bodySize >= 20))
+        {
+            const size_t interfaceId = Read32(pBody, bigEndian);
+            const uint64_t ticks = (static_cast<uint64_t>(Read32(pBody + 4, bigEndian)) << 32) |
+                                   Read32(pBody + 8, bigEndian);
+            const size_t capturedSize = Read32(pBody + 12, bigEndian);
+
+            if ((interfaceId >= interfaces.size()) || (capturedSize > (bodySize - 20)))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                              "Pcap - Invalid packet block in " + m_FileName + ".");
+            }
+
+            ParsePacket(pBody + 20, capturedSize, interfaces[interfaceId], ticks);
+        }
+
+        // The other blocks carry no timestamped packets.
+        position += blockSize;
+    }
+}
+
+void PARSER::PcapParser::ParseInterfaceOptions(const unsigned char *pOptions,
+                                               size_t size,
+                                               bool bigEndian,
+                                               Interface &rInterface) const
+{
+    const uint16_t END_OF_OPTIONS = 0U;
+    const uint16_t TIMESTAMP_RESOLUTION = 9U;
+
+    size_t position = 0;
+    while ((size - position) >= 4)
+    {
+        const uint16_t code = Read16(pOptions + position, bigEndian);
+        const size_t length = Read16(pOptions + position + 2, bigEndian);
+        position += 4;
+
+        if ((END_OF_OPTIONS == code) || (length > (size - position)))
+        {
+            break;
+        }
+
+        if ((TIMESTAMP_RESOLUTION == code) && (1 == length))
+        {
+            // The fractions of the powers of two are not supported.
+            const unsigned char resolution = pOptions[position];
+            if ((0 != (resolution & 0x80U)) || (resolution > 18))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                              "Pcap - Unsupported timestamp resolution in " + m_FileName + ".");
+            }
+            rInterface.m_Digits = resolution;
+        }
+
+        // The option values are padded to 32 bits.
+        position += (length + 3) & ~static_cast<size_t>(3);
+        if (position > size)
+        {
+            break;
+        }
+    }
+}
+
+void PARSER::PcapParser::ParsePacket(const unsigned char *pPacket,
+                                     size_t size,
+                                     const Interface &rInterface,
+                                     uint64_t ticks)
+{
+    const unsigned char *pPayload = nullptr;
+    size_t payloadSize = 0;
+
+    if (!FindPayload(pPacket, size, rInterface.m_LinkType, pPayload, payloadSize))
+    {
+        return;
+    }
+
+    // The packets are timestamped relative to the first one.
+    uint64_t packetTime = 0;
+    if (!m_rLayout.HasTimestamp())
+    {
+        uint64_t nanoseconds = 0;
+        if (!ConvertToNanoseconds(ticks, rInterface.m_Digits, nanoseconds))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                          "Pcap - Packet timestamp out of range in " + m_FileName + ".");
+        }
+
+        if (!m_Started)
+        {
+            m_Started = true;
+            m_StartTime = nanoseconds;
+        }
+
+        // The packets captured before the first one are at the start.
+        packetTime = (nanoseconds > m_StartTime) ? (nanoseconds - m_StartTime) : 0;
+
+        if (m_TimeBaseDigits >= 9)
+        {
+            const uint64_t scale = TIME::Unit::GetTenPower((m_TimeBaseDigits - 9) / 3);
+            if (packetTime > (std::numeric_limits<uint64_t>::max() / scale))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_LOG_FILE_FORMAT,
+                                              "Pcap - Packet timestamp out of range in " + m_FileName + ".");
+            }
+            packetTime *= scale;
+        }
+        else
+        {
+            packetTime /= TIME::Unit::GetTenPower((9 - m_TimeBaseDigits) / 3);
+        }
+    }
+
+    CreateSignals(pPayload, payloadSize, packetTime);
+}
+
+bool PARSER::PcapParser::FindPayload(const unsigned char *pPacket,
+                                     size_t size,
+                                     uint32_t linkType,
+                                     const unsigned char *&rpPayload,
+                                     size_t &rPayloadSize) const
+{
+    const uint32_t LINKTYPE_NULL = 0U;
+    const uint32_t LINKTYPE_ETHERNET = 1U;
+    const uint32_t LINKTYPE_RAW = 101U;
+    const uint32_t LINKTYPE_LINUX_SLL = 113U;
+    const uint32_t LINKTYPE_IPV4 = 228U;
+    const uint32_t LINKTYPE_IPV6 = 229U;
+    const uint32_t LINKTYPE_LINUX_SLL2 = 276U;
+    const uint16_t ETHERTYPE_VLAN = 0x8100U;
+    const uint16_t ETHERTYPE_QINQ = 0x88A8U;
+    const uint8_t PROTOCOL_UDP = 17U;
+    const size_t UDP_HEADER_SIZE = 8;
+
+    // The link layer header.
+    size_t position = 0;
+    switch (linkType)
+    {
+        case LINKTYPE_NULL:
+            position = 4;
+            break;
+
+        case LINKTYPE_ETHERNET:
+            // The frame holds at least the addresses and the EtherType.
+            if (size < 14)
+            {
+                return false;
+            }
+
+            position = 12;
+            while (((position + 6) <= size) &&
+                   ((ETHERTYPE_VLAN == Read16(pPacket + position, true)) ||
+                    (ETHERTYPE_QINQ == Read16(pPacket + position, true))))
+            {
+                position += 4;
+            }
+            position += 2;
+            break;
+
+        case LINKTYPE_RAW:
+        case LINKTYPE_IPV4:
+        case LINKTYPE_IPV6:
+            position = 0;
+            break;
+
+        case LINKTYPE_LINUX_SLL:
+            position = 16;
+            break;
+
+        case LINKTYPE_LINUX_SLL2:
+            position = 20;
+            break;
+
+        default:
+            return false;
+    }
+
+    // The IP version is given by the packet itself.
+    if (position >= size)
+    {
+        return false;
+    }
+
+    const unsigned char *pIp = pPacket + position;
+    size_t ipSize = size - position;
+    size_t headerSize = 0;
+
+    if ((4 == (pIp[0] >> 4)) && (ipSize >= 20))
+    {
+        headerSize = static_cast<size_t>(pIp[0] & 0x0FU) * 4;
+        const size_t totalSize = Read16(pIp + 2, true);
+
+        // The fragments are skipped.
+        if ((PROTOCOL_UDP != pIp[9]) ||
+            (0 != (Read16(pIp + 6, true) & 0x3FFFU)) ||
+            (headerSize < 20) ||
+            (totalSize < headerSize) ||
+            (totalSize > ipSize))
+        {
+            return false;
+        }
+        ipSize = totalSize;
+    }
+    else if ((6 == (pIp[0] >> 4)) && (ipSize >= 40))
+    {
+        headerSize = 40;
+        const size_t totalSize = headerSize + Read16(pIp + 4, true);
+
+        if ((PROTOCOL_UDP != pIp[6]) || (totalSize > ipSize))
+        {
+            return false;
+        }
+        ipSize = totalSize;
+    }
+    else
+    {
+        return false;
+    }
+
+    // The UDP datagram.
+    const unsigned char *pUdp = pIp + headerSize;
+    const size_t udpSize = ipSize - headerSize;
+
+    if (udpSize < UDP_HEADER_SIZE)
+    {
+        return false;
+    }
+
+    const size_t datagramSize = Read16(pUdp + 4, true);
+    if ((datagramSize < UDP_HEADER_SIZE) ||
+        (datagramSize > udpSize) ||
+        ((0 != m_rLayout.GetPort()) && (m_rLayout.GetPort() != Read16(pUdp + 2, true))))
+    {
+        return false;
+    }
+
+    rpPayload = pUdp + UDP_HEADER_SIZE;
+    rPayloadSize = datagramSize - UDP_HEADER_SIZE;
+    return true;
+}
+
+void PARSER::PcapParser::CreateSignals(const unsigned char *pPayload,
+                                       size_t size,
+                                       uint64_t packetTime)
+{
+    const size_t recordSize = m_rLayout.GetRecordSize();
+    std::string warning;
+
+    // The datagram without the complete header holds no records.
+    if (size < m_rLayout.GetHeaderSize())
+    {
+        ++m_Records;
+        if (m_VerboseMode)
+        {
+            std::cout << "Invalid log record "
+                      << m_Records
+                      << ": incomplete datagram header\n";
+        }
+        ++m_InvalidRecords;
+        return;
+    }
+
+    const unsigned char *pRecord = pPayload + m_rLayout.GetHeaderSize();
+    const size_t recordCount = (size - m_rLayout.GetHeaderSize()) / recordSize;
+
+    for (size_t record = 0; record < recordCount; ++record)
+    {
+        ++m_Records;
+
+        const uint64_t timestamp = m_rLayout.HasTimestamp() ? m_rLayout.GetTimestamp(pRecord) : packetTime;
+
+        if (m_rLayout.CreateSignal(pRecord, timestamp, m_SourceHandle, m_vpSignals, warning))
+        {
+            if (!warning.empty())
+            {
+                LOGGER::Logger::GetInstance().LogWarning(EXCEPTION::Warning::INSUFFICIENT_VECTOR_SIZE,
+                                                         "Evaluating " + m_FileName + ".\n" +
+                                                         "Record " + std::to_string(m_Records) + ".\n" +
+                                                         warning);
+                warning.clear();
+            }
+
+            AddSignals(m_vpSignals, m_Records);
+            ++m_ValidRecords;
+        }
+        else
+        {
+            if (m_VerboseMode)
+            {
+                std::cout << "Invalid log record "
+                          << m_Records
+                          << ": unknown signal identifier "
+                          << m_rLayout.GetId(pRecord)
+                          << '\n';
+            }
+            ++m_InvalidRecords;
+        }
+
+        pRecord += recordSize;
+    }
+
+    // The last record of the datagram is incomplete.
+    if (0 != ((size - m_rLayout.GetHeaderSize()) % recordSize))
+    {
+        ++m_Records;
+        if (m_VerboseMode)
+        {
+            std::cout << "Invalid log record "
+                      << m_Records
+                      << ": incomplete record\n";
+        }
+        ++m_InvalidRecords;
+    }
+}
+
+bool PARSER::PcapParser::ConvertToNanoseconds(uint64_t ticks, uint32_t digits, uint64_t &rNanoseconds)
+{
+    uint64_t scale = 1;
+
+    if (digits <= 9)
+    {
+        for (uint32_t digit = digits; digit < 9; ++digit)
+        {
+            scale *= 10;
+        }
+        if (ticks > (std::numeric_limits<uint64_t>::max() / scale))
+        {
+            return false;
+        }
+        rNanoseconds = ticks * scale;
+    }
+    else
+    {
+        for (uint32_t digit = 9; digit < digits; ++digit)
+        {
+            scale *= 10;
+        }
+        rNanoseconds = ticks / scale;
+    }
+
+    return true;
+}
+
+uint16_t PARSER::PcapParser::Read16(const unsigned char *pData, bool bigEndian)
+{
+    return bigEndian ?
+           static_cast<uint16_t>((pData[0] << 8) | pData[1]) :
+           static_cast<uint16_t>((pData[1] << 8) | pData[0]);
+}
+
+uint32_t PARSER::PcapParser::Read32(const unsigned char *pData, bool bigEndian)
+{
+    return bigEndian ?
+           ((static_cast<uint32_t>(pData[0]) << 24) | (static_cast<uint32_t>(pData[1]) << 16) |
+            (static_cast<uint32_t>(pData[2]) << 8) | pData[3]) :
+           ((static_cast<uint32_t>(pData[3]) << 24) | (static_cast<uint32_t>(pData[2]) << 16) |
+            (static_cast<uint32_t>(pData[1]) << 8) | pData[0]);
+}
@@ -0,0 +1,117 @@
+/// @file common/src/ReorderWindow.cpp
+///
+/// The reorder window class.
+///
+/// @par Full Description
+/// The object of this class is supposed to be put in front of the tracing
+/// object to restore the time order of nearly sorted signals streams.
+///
+/// @ingroup Tracer
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <string>
+
+#include "ReorderWindow.h"
+#include "VcdException.h"
+
+TRACER::ReorderWindow::ReorderWindow(SIGNAL::SignalConsumer &rConsumer,
+                                     WindowT type,
+                                     uint64_t size) :
+    m_rConsumer(rConsumer),
+    m_Type(type),
+    m_Size(size),
+    m_Signals()
+{
+}
+
+TRACER::ReorderWindow::~ReorderWindow()
+{
+    while (!m_Signals.empty())
+    {
+        delete m_Signals.top().m_pSignal;
+        m_Signals.pop();
+    }
+}
+
+void TRACER::ReorderWindow::Begin()
+{
+    m_rConsumer.Begin();
+}
+
+void TRACER::ReorderWindow::Consume(SIGNAL::Signal *pSignal)
+{
+    const uint64_t timestamp = pSignal->GetTimestamp().GetValue();
+
+    // Signals older than the ones passed over cannot be put in order.
+    if (timestamp < m_EmittedTimestamp)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::SIGNAL_BEYOND_REORDER_WINDOW,
+                                      "Signal beyond the reorder window: " + pSignal->GetName() +
+                                      ". Timestamp " + std::to_string(timestamp) +
+                                      " precedes " + std::to_string(m_EmittedTimestamp) + ".");
+    }
+
+    m_Signals.push({timestamp, m_Sequence, pSignal});
+    ++m_Sequence;
+
+    if (WindowT::TIME == m_Type)
+    {
+        if (timestamp > m_NewestTimestamp)
+        {
+            m_NewestTimestamp = timestamp;
+        }
+
+        // Signals up to the watermark can no longer be preceded.
+        const uint64_t watermark = (m_NewestTimestamp > m_Size) ? (m_NewestTimestamp - m_Size) : 0;
+        while (!m_Signals.empty() && (m_Signals.top().m_Timestamp < watermark))
+        {
+            Emit();
+        }
+    }
+    else
+    {
+        while (m_Signals.size() > m_Size)
+        {
+            Emit();
+        }
+    }
+}
+
+void TRACER::ReorderWindow::End()
+{
+    while (!m_Signals.empty())
+    {
+        Emit();
+    }
+
+    m_rConsumer.End();
+}
+
+void TRACER::ReorderWindow::Emit()
+{
+    const Entry &rOldest = m_Signals.top();
+
+    // The signal stays buffered if the consumer does not take it over.
+    m_rConsumer.Consume(rOldest.m_pSignal);
+    m_EmittedTimestamp = rOldest.m_Timestamp;
+    m_Signals.pop();
+}
@@ -29,6 +29,7 @@
 /// IN THE SOFTWARE.
 
 #include "SignalDb.h"
+#include "SignalSorter.h"
 #include "VcdException.h"
 #include "SourceRegistry.h"
 
@@ -39,13 +40,23 @@ SIGNAL::SignalDb::SignalDb(const std::string &rTimeUnit) :
 
 SIGNAL::SignalDb::~SignalDb()
 {
-    for (const SIGNAL::Signal *signal : m_SignalSet)
+    for (const SIGNAL::Signal *signal : m_Prototypes)
+    {
+        delete signal;
+    }
+
+    for (const SIGNAL::Signal *signal : m_Signals)
+    {
+        delete signal;
+    }
+
+    for (const SIGNAL::Signal *signal : m_LastValues)
     {
         delete signal;
     }
 }
 
-void SIGNAL::SignalDb::Add(const SIGNAL::Signal *pSignal)
+void SIGNAL::SignalDb::Add(SIGNAL::Signal *pSignal)
 {
     // A signal shall have a valid source once added to the database.
     if (pSignal->GetSource() == SourceRegistry::BAD_HANDLE)
@@ -55,17 +66,23 @@ void SIGNAL::SignalDb::Add(const SIGNAL::Signal *pSignal)
                                       "Invalid signal source.");
     }
 
-    const auto it = m_AddedSignals.find(pSignal->GetName());
+    const auto it = m_SignalIds.find(pSignal->GetName());
 
     // Is this a new signal to be logged?
-    if (it == m_AddedSignals.end())
+    if (it == m_SignalIds.end())
     {
-        m_AddedSignals[pSignal->GetName()] = pSignal;
+        const SIGNAL::Signal::IdT id = static_cast<SIGNAL::Signal::IdT>(m_Prototypes.size());
+        pSignal->SetId(id);
+        const SIGNAL::Signal *pPrototype = pSignal->Clone();
+        m_Prototypes.push_back(pPrototype);
+        m_SignalIds.emplace(pPrototype->GetName(), id);
     }
     else
     {
+        const SIGNAL::Signal *pPrototype = m_Prototypes[it->second];
+
         // Check signal consistency
-        if (!it->second->SimilarTo(*pSignal))
+        if (!pPrototype->SimilarTo(*pSignal))
         {
             std::string signalName(pSignal->GetName());
             std::string signalType(pSignal->GetType());
@@ -75,16 +92,113 @@ void SIGNAL::SignalDb::Add(const SIGNAL::Signal *pSignal)
                                           "Inconsistent signal: " +
                                           signalName +
                                           ". Types: " +
-                                          it->second->GetType() + " / " + signalType +
+                                          pPrototype->GetType() + " / " + signalType +
                                           ". Sizes: " +
-                                          std::to_string(it->second->GetSize()) + " / " + signalSize +
+                                          std::to_string(pPrototype->GetSize()) + " / " + signalSize +
                                           ". Sources: " +
-                                          SIGNAL::SourceRegistry::GetInstance().GetSourceName(it->second->GetSource()) +
+                                          SIGNAL::SourceRegistry::GetInstance().GetSourceName(pPrototype->GetSource()) +
                                           " and " +
                                           signalSource + ".");
         }
+
+        pSignal->SetId(it->second);
+    }
+
+    if (m_DropUnchanged && !IsValueChanged(pSignal))
+    {
+        delete pSignal;
+        return;
+    }
+
+    if (nullptr != m_pConsumer)
+    {
+        m_pConsumer->Consume(pSignal);
+    }
+    else
+    {
+        // Make room for the signal.
+        if ((0 != m_MemoryBudget) && (m_Signals.size() >= m_MemoryBudget))
+        {
+            Spill();
+        }
+
+        // Sorted input needs no sorting at the end.
+        if (m_Sorted && !m_Signals.empty())
+        {
+            m_Sorted = !(pSignal->GetTimestamp() < m_Signals.back()->GetTimestamp());
+        }
+
+        // Store the full signal data
+        m_Signals.push_back(pSignal);
+    }
+}
+
+const SIGNAL::UniqueSignalsCollectionT &SIGNAL::SignalDb::GetSignalFootprint() const
+{
+    // The identifiers are dense, so the new signals follow the ones already ordered.
+    for (size_t id = m_Footprint.size(); id < m_Prototypes.size(); ++id)
+    {
+        m_Footprint.emplace(m_Prototypes[id]->GetName(), m_Prototypes[id]);
     }
 
-    // Store the full signal data
-    m_SignalSet.insert(pSignal);
+    return m_Footprint;
+}
+
+void SIGNAL::SignalDb::Finalize()
+{
+    if (!m_Sorted)
+    {
+        const SIGNAL::SignalSorter sorter;
+        sorter.Sort(m_Signals);
+        m_Sorted = true;
+    }
+}
+
+bool SIGNAL::SignalDb::IsValueChanged(const SIGNAL::Signal *pSignal)
+{
+    const SIGNAL::Signal::IdT id = pSignal->GetId();
+
+    if (id >= m_LastValues.size())
+    {
+        m_LastValues.resize(id + 1, nullptr);
+    }
+
+    SIGNAL::Signal *pLastValue = m_LastValues[id];
+
+    if (nullptr != pLastValue)
+    {
+        // A late signal might change the value of the dropped ones.
+        if (pSignal->GetTimestamp() < pLastValue->GetTimestamp())
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::UNSORTED_SIGNAL,
+                                          "Unsorted signal: " + pSignal->GetName() +
+                                          ". Timestamp " + std::to_string(pSignal->GetTimestamp().GetValue()) +
+                                          " follows " + std::to_string(pLastValue->GetTimestamp().GetValue()) + ".");
+        }
+
+        if (*pLastValue == *pSignal)
+        {
+            pLastValue->SetTimestamp(pSignal->GetTimestamp());
+            return false;
+        }
+    }
+
+    SIGNAL::Signal *pValue = pSignal->Clone();
+    delete pLastValue;
+    m_LastValues[id] = pValue;
+
+    return true;
+}
+
+void SIGNAL::SignalDb::Spill()
+{
+    Finalize();
+
+    m_Runs.Spill(m_Signals);
+
+    for (const SIGNAL::Signal *signal : m_Signals)
+    {
+        delete signal;
+    }
+    m_Signals.clear();
 }
@@ -27,6 +27,8 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 /// IN THE SOFTWARE.
 
+#include <utility>
+
 #include "SignalFactory.h"
 #include "EventSignalCreator.h"
 #include "ISignalCreator.h"
@@ -35,14 +37,18 @@
 #include "EvaluatorExceptions.h"
 #include "Logger.h"
 
-PARSER::SignalFactory::SignalFactory() :
-    m_vpSignalCreators()
+PARSER::SignalFactory::SignalFactory(bool exclusive) :
+    m_vpSignalCreators(),
+    m_Exclusive(exclusive),
+    m_CreatorOrder(),
+    m_CreatorHits()
 {
 }
 
-std::vector<const SIGNAL::Signal*> PARSER::SignalFactory::Create(std::string &logLine,
-                                                                 INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                                                 SIGNAL::SourceRegistry::HandleT sourceHandle) const
+size_t PARSER::SignalFactory::Create(std::string &logLine,
+                                    INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                    SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                    std::vector<SIGNAL::Signal *> &rvpSignals) const
 {
     if (m_vpSignalCreators.empty())
     {
@@ -50,44 +56,110 @@ std::vector<const SIGNAL::Signal*> PARSER::SignalFactory::Create(std::string &lo
                                       "No signals creators. Hint: Verify the correctness of the XML file specifying the user log format.");
     }
 
-    std::vector<const SIGNAL::Signal *> vpSignals;
+    const size_t initialSize = rvpSignals.size();
+    CreationSink sink(rvpSignals);
 
-    for (const auto &creator : m_vpSignalCreators)
+    if (m_Exclusive)
     {
-        SIGNAL::Signal *pSignal = nullptr;
-
-        try
-        {
-            // Try to use creator.
-            pSignal = creator->Create(logLine, lineNumber, sourceHandle);
-        }
-        catch (const PARSER::EXCEPTIONS::EvaluatorException &evaluatorError)
+        // The creators might have been added after the construction.
+        if (m_CreatorOrder.size() != m_vpSignalCreators.size())
         {
-            throw EXCEPTION::VcdException(EXCEPTION::Error::EXPRESSION_EVALUATION_ERROR,
-                                          GetLogLineInfo(sourceHandle, lineNumber, logLine) +
-                                          evaluatorError.what());
+            m_CreatorOrder.resize(m_vpSignalCreators.size());
+            m_CreatorHits.assign(m_vpSignalCreators.size(), 0);
+
+            for (size_t index = 0; index < m_CreatorOrder.size(); ++index)
+            {
+                m_CreatorOrder[index] = index;
+            }
         }
-        catch (const EXCEPTION::TooSmallVector &smallVector)
+
+        // Only one creator may match the line, so the most frequent ones are tried first.
+        for (size_t position = 0; position < m_CreatorOrder.size(); ++position)
         {
-            LOGGER::Logger::GetInstance().LogWarning(EXCEPTION::Warning::INSUFFICIENT_VECTOR_SIZE,
-                                                     GetLogLineInfo(sourceHandle, lineNumber, logLine) +
-                                                     smallVector.what());
+            if (CreateSignals(*m_vpSignalCreators[m_CreatorOrder[position]],
+                              logLine,
+                              lineNumber,
+                              sourceHandle,
+                              sink))
+            {
+                CountHit(position);
+                break;
+            }
         }
-        catch (const std::regex_error &regexError)
+    }
+    else
+    {
+        for (const auto &creator : m_vpSignalCreators)
         {
-            throw EXCEPTION::VcdException(EXCEPTION::Error::REGEX_ERROR,
-                                          regexError.what() +
-                                          std::string("\nRegex: ") + creator->GetRegEx());
+            CreateSignals(*creator, logLine, lineNumber, sourceHandle, sink);
         }
+    }
 
-        // If successful add created Signal to the returned vector.
-        if (pSignal != nullptr)
-        {
-            vpSignals.push_back(pSignal);
-        }
+    return rvpSignals.size() - initialSize;
+}
+
+std::unique_ptr<PARSER::SignalFactory> PARSER::SignalFactory::Clone() const
+{
+    std::unique_ptr<SignalFactory> pClone = std::make_unique<SignalFactory>(m_Exclusive);
+
+    for (const auto &creator : m_vpSignalCreators)
+    {
+        pClone->m_vpSignalCreators.push_back(creator->Clone());
     }
 
-    return vpSignals;
+    pClone->m_CreatorOrder = m_CreatorOrder;
+    pClone->m_CreatorHits = m_CreatorHits;
+
+    return pClone;
+}
+
+bool PARSER::SignalFactory::CreateSignals(const SignalCreator &rCreator,
+                                          const std::string &logLine,
+                                          INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                          SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                          CreationSink &rSink) const
+{
+    bool matched = false;
+
+    try
+    {
+        // Try to use creator.
+        matched = rCreator.Create(logLine, lineNumber, sourceHandle, rSink);
+    }
+    catch (const PARSER::EXCEPTIONS::EvaluatorException &evaluatorError)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::EXPRESSION_EVALUATION_ERROR,
+                                      GetLogLineInfo(sourceHandle, lineNumber, logLine) +
+                                      evaluatorError.what());
+    }
+    catch (const std::regex_error &regexError)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::REGEX_ERROR,
+                                      regexError.what() +
+                                      std::string("\nRegex: ") + rCreator.GetRegEx());
+    }
+
+    // Warnings are added by the creators, only fatal errors are thrown.
+    for (const CreationSink::Warning &rWarning : rSink.GetWarnings())
+    {
+        LOGGER::Logger::GetInstance().LogWarning(rWarning.m_Id,
+                                                 GetLogLineInfo(sourceHandle, lineNumber, logLine) +
+                                                 rWarning.m_Message);
+    }
+    rSink.ClearWarnings();
+
+    return matched;
+}
+
+void PARSER::SignalFactory::CountHit(size_t position) const
+{
+    const uint64_t hits = ++m_CreatorHits[m_CreatorOrder[position]];
+
+    while ((position > 0) && (m_CreatorHits[m_CreatorOrder[position - 1]] < hits))
+    {
+        std::swap(m_CreatorOrder[position - 1], m_CreatorOrder[position]);
+        --position;
+    }
 }
 
 std::string PARSER::SignalFactory::GetLogLineInfo(SIGNAL::SourceRegistry::HandleT sourceHandle,
@@ -0,0 +1,205 @@
+/// @file common/src/SignalRuns.cpp
+///
+/// The spilled signal runs class.
+///
+/// @par Full Description
+/// The object of this class is supposed to be used by the signal database
+/// to keep time-sorted runs of signals in temporary files.
+///
+/// @ingroup Signal
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <queue>
+#include <random>
+#include <sstream>
+#include <utility>
+
+#include "SignalRuns.h"
+#include "VcdException.h"
+
+SIGNAL::SignalRuns::SignalRuns() :
+    m_Directory(),
+    m_Files()
+{
+}
+
+SIGNAL::SignalRuns::~SignalRuns()
+{
+    if (!m_Directory.empty())
+    {
+        std::error_code error;
+        std::filesystem::remove_all(m_Directory, error);
+    }
+}
+
+void SIGNAL::SignalRuns::Spill(const SignalCollectionT &rSignals)
+{
+    if (m_Directory.empty())
+    {
+        CreateRunDirectory();
+    }
+
+    const std::string fileName = CreateFileName();
+    std::ofstream run(fileName, std::ofstream::out | std::ofstream::binary | std::ofstream::trunc);
+
+    if (!run.is_open())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE,
+                                      "Creating temporary file '" + fileName + "' failed.");
+    }
+    m_Files.push_back(fileName);
+
+    for (const Signal *pSignal : rSignals)
+    {
+        Write<uint64_t>(run, pSignal->GetTimestamp().GetValue());
+        Write<Signal::IdT>(run, pSignal->GetId());
+        pSignal->Serialize(run);
+    }
+
+    run.close();
+    if (run.fail())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE,
+                                      "Writing temporary file '" + fileName + "' failed.");
+    }
+}
+
+void SIGNAL::SignalRuns::Merge(const PrototypesT &rPrototypes,
+                               const SignalCollectionT &rSignals,
+                               SignalConsumer &rConsumer) const
+{
+    // The merged source: a run or, as the last one, the signals in memory.
+    struct Source
+    {
+        std::ifstream m_Run;
+        SignalCollectionT::const_iterator m_Next;
+        std::unique_ptr<Signal> m_pHead;
+    };
+
+    // The heap of sources ordered by their head timestamps and then indexes.
+    using HeapEntryT = std::pair<uint64_t, size_t>;
+    std::priority_queue<HeapEntryT, std::vector<HeapEntryT>, std::greater<HeapEntryT>> heap;
+
+    const size_t memorySource = m_Files.size();
+    std::vector<Source> sources(memorySource + 1);
+
+    // Loads the next signal of the source into its head.
+    auto advance = [&](size_t index)
+    {
+        Source &rSource = sources[index];
+        rSource.m_pHead.reset();
+
+        if (index == memorySource)
+        {
+            if (rSource.m_Next != rSignals.cend())
+            {
+                rSource.m_pHead.reset((*rSource.m_Next)->Clone());
+                ++rSource.m_Next;
+            }
+        }
+        else
+        {
+            uint64_t timestamp = 0;
+            Signal::IdT id = Signal::INVALID_ID;
+
+            if (Read(rSource.m_Run, timestamp) && Read(rSource.m_Run, id))
+            {
+                rSource.m_pHead.reset(rPrototypes.at(id)->Deserialize(timestamp, rSource.m_Run));
+                rSource.m_pHead->SetId(id);
+            }
+            else if (!rSource.m_Run.eof())
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE,
+                                              "Reading temporary file '" + m_Files[index] + "' failed.");
+            }
+        }
+
+        if (rSource.m_pHead)
+        {
+            heap.emplace(rSource.m_pHead->GetTimestamp().GetValue(), index);
+        }
+    };
+
+    for (size_t index = 0; index < memorySource; ++index)
+    {
+        sources[index].m_Run.open(m_Files[index], std::ifstream::in | std::ifstream::binary);
+        if (!sources[index].m_Run.is_open())
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE,
+                                          "Opening temporary file '" + m_Files[index] + "' failed.");
+        }
+        advance(index);
+    }
+    sources[memorySource].m_Next = rSignals.cbegin();
+    advance(memorySource);
+
+    while (!heap.empty())
+    {
+        const size_t index = heap.top().second;
+        heap.pop();
+
+        rConsumer.Consume(sources[index].m_pHead.get());
+        sources[index].m_pHead.release();
+
+        advance(index);
+    }
+}
+
+void SIGNAL::SignalRuns::CreateRunDirectory()
+{
+    const size_t MAX_ATTEMPTS = 16;
+
+    std::random_device random;
+    std::error_code error;
+    const std::filesystem::path temporary = std::filesystem::temp_directory_path(error);
+
+    // The directory is created only if it does not exist yet, so a file
+    // or a link planted under the same name is never written through.
+    for (size_t attempt = 0; !error && (attempt < MAX_ATTEMPTS); ++attempt)
+    {
+        std::ostringstream name;
+        name << "vcdMaker-" << std::hex << random() << random();
+
+        const std::filesystem::path directory = temporary / name.str();
+        if (std::filesystem::create_directory(directory, error))
+        {
+            m_Directory = directory.string();
+            std::filesystem::permissions(directory, std::filesystem::perms::owner_all, error);
+            if (!error)
+            {
+                return;
+            }
+        }
+    }
+
+    throw EXCEPTION::VcdException(EXCEPTION::Error::CANNOT_OPEN_FILE,
+                                  "Creating temporary directory in '" + temporary.string() + "' failed.");
+}
+
+std::string SIGNAL::SignalRuns::CreateFileName() const
+{
+    return (std::filesystem::path(m_Directory) / (std::to_string(m_Files.size()) + ".run")).string();
+}
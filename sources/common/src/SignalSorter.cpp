@@ -0,0 +1,276 @@
+/// @file common/src/SignalSorter.cpp
+///
+/// The signal sorter class.
+///
+/// @ingroup Signal
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <array>
+#include <system_error>
+
+#include "SignalSorter.h"
+
+SIGNAL::SignalSorter::SignalSorter(size_t threads, size_t minPartitionSize) :
+    m_Threads(threads),
+    m_MinPartitionSize(std::max<size_t>(minPartitionSize, 1))
+{
+    if (0 == m_Threads)
+    {
+        m_Threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    }
+}
+
+void SIGNAL::SignalSorter::Sort(SignalCollectionT &rSignals) const
+{
+    const size_t count = rSignals.size();
+
+    if (count < 2)
+    {
+        return;
+    }
+
+    const size_t threads = std::max<size_t>(std::min(m_Threads, count / m_MinPartitionSize), 1);
+
+    std::vector<Record> records(count);
+    std::vector<Record> buffer(count);
+
+    // The bounds of the sorted runs.
+    std::vector<size_t> runs;
+    for (size_t partition = 0; partition <= threads; ++partition)
+    {
+        runs.push_back(count * partition / threads);
+    }
+
+    std::vector<std::thread> workers;
+
+    // Sort the partitions.
+    for (size_t partition = 0; partition < threads; ++partition)
+    {
+        const size_t begin = runs[partition];
+        const size_t end = runs[partition + 1];
+
+        const std::function<void()> sortPartition = [&rSignals, &records, &buffer, begin, end]()
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                records[i] = {rSignals[i]->GetTimestamp().GetValue(), rSignals[i]};
+            }
+
+            RadixSort(&records[begin], &buffer[begin], end - begin);
+        };
+
+        if (1 == threads)
+        {
+            sortPartition();
+        }
+        else
+        {
+            Spawn(workers, sortPartition);
+        }
+    }
+
+    Join(workers);
+
+    // Merge the pairs of adjacent runs until a single one is left.
+    while (runs.size() > 2)
+    {
+        const size_t runCount = runs.size() - 1;
+        const size_t segments = std::max<size_t>(threads / (runCount / 2), 1);
+        std::vector<size_t> mergedRuns;
+
+        for (size_t run = 0; run < runCount; run += 2)
+        {
+            const size_t begin = runs[run];
+
+            if (run + 1 == runCount)
+            {
+                // The odd run is just moved.
+                std::copy(records.cbegin() + begin, records.cend(), buffer.begin() + begin);
+                mergedRuns.push_back(begin);
+                break;
+            }
+
+            const size_t middle = runs[run + 1];
+            const size_t end = runs[run + 2];
+
+            for (size_t segment = 0; segment < segments; ++segment)
+            {
+                const size_t segmentBegin = (end - begin) * segment / segments;
+                const size_t segmentEnd = (end - begin) * (segment + 1) / segments;
+
+                Spawn(workers, [&records, &buffer, begin, middle, end, segmentBegin, segmentEnd]()
+                {
+                    MergeSegment(&records[begin], middle - begin,
+                                 &records[middle], end - middle,
+                                 &buffer[begin], segmentBegin, segmentEnd);
+                });
+            }
+
+            mergedRuns.push_back(begin);
+        }
+
+        Join(workers);
+
+        mergedRuns.push_back(count);
+        runs.swap(mergedRuns);
+        records.swap(buffer);
+    }
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        rSignals[i] = records[i].m_pSignal;
+    }
+}
+
+void SIGNAL::SignalSorter::RadixSort(Record *pRecords, Record *pBuffer, size_t count)
+{
+    // The number of bits sorted in one pass.
+    constexpr uint32_t DIGIT_BITS = 8;
+
+    // The number of the digit values.
+    constexpr size_t DIGIT_VALUES = (1U << DIGIT_BITS);
+
+    // The number of the timestamp digits.
+    constexpr size_t DIGITS = (sizeof(uint64_t) * 8) / DIGIT_BITS;
+
+    if (count < 2)
+    {
+        return;
+    }
+
+    // Histograms of all the digits are built in a single pass.
+    std::array<std::array<size_t, DIGIT_VALUES>, DIGITS> histograms{};
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        for (size_t digit = 0; digit < DIGITS; ++digit)
+        {
+            ++histograms[digit][(pRecords[i].m_Timestamp >> (digit * DIGIT_BITS)) & (DIGIT_VALUES - 1)];
+        }
+    }
+
+    Record *pSource = pRecords;
+    Record *pTarget = pBuffer;
+
+    for (size_t digit = 0; digit < DIGITS; ++digit)
+    {
+        const uint32_t shift = static_cast<uint32_t>(digit * DIGIT_BITS);
+        std::array<size_t, DIGIT_VALUES> &rHistogram = histograms[digit];
+
+        // The pass does not change the order if all the records share the digit.
+        if (count == rHistogram[(pSource->m_Timestamp >> shift) & (DIGIT_VALUES - 1)])
+        {
+            continue;
+        }
+
+        // Turn the counts into the output offsets.
+        size_t offset = 0;
+        for (size_t &rBucket : rHistogram)
+        {
+            const size_t bucketSize = rBucket;
+            rBucket = offset;
+            offset += bucketSize;
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            pTarget[rHistogram[(pSource[i].m_Timestamp >> shift) & (DIGIT_VALUES - 1)]++] = pSource[i];
+        }
+
+        std::swap(pSource, pTarget);
+    }
+
+    if (pSource != pRecords)
+    {
+        std::copy(pSource, pSource + count, pRecords);
+    }
+}
+
+size_t SIGNAL::SignalSorter::FindSplit(const Record *pLeft,
+                                       size_t leftCount,
+                                       const Record *pRight,
+                                       size_t rightCount,
+                                       size_t diagonal)
+{
+    size_t low = (diagonal > rightCount) ? (diagonal - rightCount) : 0;
+    size_t high = std::min(diagonal, leftCount);
+
+    while (low < high)
+    {
+        const size_t middle = low + (high - low) / 2;
+
+        // The left record precedes the right one of an equal timestamp.
+        if (pRight[diagonal - middle - 1].m_Timestamp < pLeft[middle].m_Timestamp)
+        {
+            high = middle;
+        }
+        else
+        {
+            low = middle + 1;
+        }
+    }
+
+    return low;
+}
+
+void SIGNAL::SignalSorter::MergeSegment(const Record *pLeft,
+                                        size_t leftCount,
+                                        const Record *pRight,
+                                        size_t rightCount,
+                                        Record *pOutput,
+                                        size_t begin,
+                                        size_t end)
+{
+    const size_t leftBegin = FindSplit(pLeft, leftCount, pRight, rightCount, begin);
+    const size_t leftEnd = FindSplit(pLeft, leftCount, pRight, rightCount, end);
+
+    std::merge(pLeft + leftBegin, pLeft + leftEnd,
+               pRight + (begin - leftBegin), pRight + (end - leftEnd),
+               pOutput + begin,
+               [](const Record &rLhs, const Record &rRhs)
+    {
+        return (rLhs.m_Timestamp < rRhs.m_Timestamp);
+    });
+}
+
+void SIGNAL::SignalSorter::Spawn(std::vector<std::thread> &rWorkers, const std::function<void()> &rTask)
+{
+    try
+    {
+        rWorkers.emplace_back(rTask);
+    }
+    catch (const std::system_error &)
+    {
+        rTask();
+    }
+}
+
+void SIGNAL::SignalSorter::Join(std::vector<std::thread> &rWorkers)
+{
+    for (std::thread &rWorker : rWorkers)
+    {
+        rWorker.join();
+    }
+
+    rWorkers.clear();
+}
@@ -24,86 +24,111 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 /// IN THE SOFTWARE.
 
-#include <algorithm>
-
 #include "SignalStructureBuilder.h"
 
 void TRACER::SignalStructureBuilder::Dump()
 {
-    SIGNAL::Signal::SignalNameFieldsT previous_fields;
+    BuildTrie();
+    DumpChildren(ROOT_NODE, 0);
+}
+
+void TRACER::SignalStructureBuilder::BuildTrie()
+{
+    m_Nodes.clear();
+    m_Nodes.reserve(m_UniqueSignals.size() + 1);
+    m_Nodes.push_back({std::string_view(), nullptr, NO_NODE, NO_NODE, NO_NODE});
 
     for (const auto &unique_signal : m_UniqueSignals)
     {
-        const SIGNAL::Signal *signal = unique_signal.second;
-        const SIGNAL::Signal::SignalNameFieldsT current_fields = signal->GetNameFields();
-
-        bool found_mismatch = false;
-        std::size_t continue_index = 0;
-
-        std::tie(found_mismatch, continue_index) = FindContinuation(current_fields, previous_fields);
-
-        if (found_mismatch)
-        {
-            EndScopesDownTo(previous_fields, continue_index);
-        }
+        Insert(unique_signal.second);
+    }
+}
 
-        ContinueScopes(continue_index, current_fields, signal);
+void TRACER::SignalStructureBuilder::Insert(const SIGNAL::Signal *pSignal)
+{
+    std::string_view name(pSignal->GetName());
 
-        previous_fields = current_fields;
+    if (name.empty())
+    {
+        return;
     }
 
-    EndScopesDownTo(previous_fields, 0);
-}
+    // Just like splitting the name, ignore the trailing delimiter.
+    if (name.back() == SIGNAL::Signal::SIGNAL_NAME_DELIM)
+    {
+        name.remove_suffix(1);
+    }
 
-std::tuple<bool, std::size_t> TRACER::SignalStructureBuilder::FindContinuation(const SIGNAL::Signal::SignalNameFieldsT
-                                                                               &currentFields,
-                                                                               const SIGNAL::Signal::SignalNameFieldsT &previousFields)
-{
-    const std::size_t common_size = std::min(currentFields.size(), previousFields.size());
+    NodeIndexT node = ROOT_NODE;
+    std::size_t delim = name.find(SIGNAL::Signal::SIGNAL_NAME_DELIM);
 
-    for (std::size_t i = 0; i < common_size; ++i)
+    while (delim != std::string_view::npos)
     {
-        if (currentFields[i] != previousFields[i])
+        const std::string_view scope = name.substr(0, delim);
+        const NodeIndexT last = m_Nodes[node].m_LastChild;
+
+        if ((last != NO_NODE) &&
+            (nullptr == m_Nodes[last].m_pSignal) &&
+            (m_Nodes[last].m_Name == scope))
+        {
+            node = last;
+        }
+        else
         {
-            return std::make_tuple(true, i);
+            node = AppendChild(node, scope, nullptr);
         }
+
+        name.remove_prefix(delim + 1);
+        delim = name.find(SIGNAL::Signal::SIGNAL_NAME_DELIM);
     }
 
-    return std::make_tuple(false, common_size);
+    AppendChild(node, name, pSignal);
 }
 
-void TRACER::SignalStructureBuilder::EndScopesDownTo(const SIGNAL::Signal::SignalNameFieldsT &fields,
-                                                     std::size_t lowerLimit)
+TRACER::SignalStructureBuilder::NodeIndexT TRACER::SignalStructureBuilder::AppendChild(NodeIndexT parent,
+                                                                                       std::string_view name,
+                                                                                       const SIGNAL::Signal *pSignal)
 {
-    if (fields.empty())
+    const NodeIndexT child = m_Nodes.size();
+    m_Nodes.push_back({name, pSignal, NO_NODE, NO_NODE, NO_NODE});
+
+    Node &rParent = m_Nodes[parent];
+    if (NO_NODE == rParent.m_LastChild)
     {
-        return;
+        rParent.m_FirstChild = child;
     }
-
-    for (std::size_t j = fields.size() - 1; j > lowerLimit; --j)
+    else
     {
-        DumpIndented("$upscope $end", j - 1);
+        m_Nodes[rParent.m_LastChild].m_NextSibling = child;
     }
+    rParent.m_LastChild = child;
+
+    return child;
 }
 
-void TRACER::SignalStructureBuilder::ContinueScopes(std::size_t continueFrom,
-                                                    const SIGNAL::Signal::SignalNameFieldsT &fields,
-                                                    const SIGNAL::Signal *signal)
+void TRACER::SignalStructureBuilder::DumpChildren(NodeIndexT parent, std::size_t indentLevel)
 {
-    for (std::size_t i = continueFrom; i < fields.size(); ++i)
+    for (NodeIndexT child = m_Nodes[parent].m_FirstChild;
+         child != NO_NODE;
+         child = m_Nodes[child].m_NextSibling)
     {
-        if (i == (fields.size() - 1))
+        const Node &rNode = m_Nodes[child];
+
+        DumpIndent(indentLevel);
+        if (nullptr != rNode.m_pSignal)
         {
-            DumpIndented("$var " +
-                         signal->GetType() + " " +
-                         std::to_string(signal->GetSize()) + " " +
-                         signal->GetName() + " " +
-                         fields[i] + " $end",
-                         i);
+            m_Output << "$var "
+                     << rNode.m_pSignal->GetType() << ' '
+                     << rNode.m_pSignal->GetSize() << ' '
+                     << rNode.m_pSignal->GetName() << ' '
+                     << rNode.m_Name << " $end\n";
         }
         else
         {
-            DumpIndented("$scope module " + fields[i] + " $end", i);
+            m_Output << "$scope module " << rNode.m_Name << " $end\n";
+            DumpChildren(child, indentLevel + 1);
+            DumpIndent(indentLevel);
+            m_Output << "$upscope $end\n";
         }
     }
 }
@@ -31,15 +31,53 @@
 #include "SourceRegistry.h"
 #include "VcdException.h"
 
+SIGNAL::SourceRegistry::SourceRegistry() :
+    m_Registry(),
+    m_RegistryMutex(),
+    m_Names(),
+    m_Count(0)
+{
+    for (std::atomic<std::string *> &rSegment : m_Names)
+    {
+        rSegment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+SIGNAL::SourceRegistry::~SourceRegistry()
+{
+    for (std::atomic<std::string *> &rSegment : m_Names)
+    {
+        delete[] rSegment.load(std::memory_order_relaxed);
+    }
+}
+
 SIGNAL::SourceRegistry::HandleT SIGNAL::SourceRegistry::Register(const std::string &rSourceName)
 {
+    const std::lock_guard<std::mutex> lock(m_RegistryMutex);
+
     const HandleT existing_handle = GetHandleForSource(rSourceName);
 
     if (existing_handle == BAD_HANDLE)
     {
         const HandleT new_handle = GetNewHandle();
+        const size_t index = GetIndex(new_handle);
+
+        size_t offset = 0;
+        const size_t segment = GetSegment(index, offset);
+
+        std::string *pNames = m_Names[segment].load(std::memory_order_relaxed);
+        if (nullptr == pNames)
+        {
+            pNames = new std::string[FIRST_SEGMENT_SIZE << segment];
+            m_Names[segment].store(pNames, std::memory_order_release);
+        }
+
+        pNames[offset] = rSourceName;
         m_Registry[rSourceName] = new_handle;
 
+        // Publish the name.
+        m_Count.store(index + 1, std::memory_order_release);
+
         return new_handle;
     }
     else
@@ -48,14 +86,16 @@ SIGNAL::SourceRegistry::HandleT SIGNAL::SourceRegistry::Register(const std::stri
     }
 }
 
-std::string SIGNAL::SourceRegistry::GetSourceName(const HandleT sourceHandle) const
+const std::string &SIGNAL::SourceRegistry::GetSourceName(const HandleT sourceHandle) const
 {
-    for (const auto &registryItem : m_Registry)
+    const size_t index = GetIndex(sourceHandle);
+
+    if ((BAD_HANDLE != sourceHandle) && (index < m_Count.load(std::memory_order_acquire)))
     {
-        if (sourceHandle == registryItem.second)
-        {
-            return registryItem.first;
-        }
+        size_t offset = 0;
+        const size_t segment = GetSegment(index, offset);
+
+        return m_Names[segment].load(std::memory_order_acquire)[offset];
     }
 
     throw EXCEPTION::VcdLogicException(EXCEPTION::Error::CANNOT_FIND_SOURCE_SIGNAL_NAME,
@@ -90,3 +130,17 @@ SIGNAL::SourceRegistry::HandleT SIGNAL::SourceRegistry::GetNewHandle()
                                            "Too many signal sources!");
     }
 }
+
+size_t SIGNAL::SourceRegistry::GetSegment(size_t index, size_t &rOffset)
+{
+    // The segment s starts at FIRST_SEGMENT_SIZE * (2^s - 1).
+    size_t segment = 0;
+    for (size_t blocks = index / FIRST_SEGMENT_SIZE + 1; blocks > 1; blocks >>= 1)
+    {
+        ++segment;
+    }
+
+    rOffset = index - FIRST_SEGMENT_SIZE * ((static_cast<size_t>(1) << segment) - 1);
+
+    return segment;
+}
@@ -28,14 +28,63 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 /// IN THE SOFTWARE.
 
+#include <algorithm>
+
 #include "TimeFrame.h"
 
+TRACER::TimeFrame::TimeFrame(const TIME::Timestamp &rTimestamp,
+                             const SIGNAL::UniqueSignalsCollectionT &rSignals,
+                             std::ostream &rFile,
+                             bool ownsSignals) :
+    m_Timestamp(rTimestamp),
+    m_rFile(rFile),
+    m_Indexes(rSignals.size()),
+    m_Signals(rSignals.size(), nullptr),
+    m_SignalGenerations(rSignals.size(), 0),
+    m_FrameSignals(),
+    m_OwnsSignals(ownsSignals)
+{
+    // The footprint is ordered by names, so are the indexes.
+    size_t index = 0;
+    for (const auto &signal : rSignals)
+    {
+        m_Indexes[signal.second->GetId()] = index;
+        ++index;
+    }
+}
+
+TRACER::TimeFrame::~TimeFrame()
+{
+    if (m_OwnsSignals)
+    {
+        for (const SIGNAL::Signal *pSignal : m_Signals)
+        {
+            delete pSignal;
+        }
+    }
+}
+
 void TRACER::TimeFrame::Add(const SIGNAL::Signal *pSignal)
 {
-    if (WasSignalValueAdded(pSignal))
+    const size_t index = m_Indexes[pSignal->GetId()];
+
+    if (WasSignalValueAdded(index, pSignal))
+    {
+        if (m_OwnsSignals)
+        {
+            delete m_Signals[index];
+        }
+        m_Signals[index] = pSignal;
+
+        if (m_SignalGenerations[index] != m_Generation)
+        {
+            m_SignalGenerations[index] = m_Generation;
+            m_FrameSignals.push_back(index);
+        }
+    }
+    else if (m_OwnsSignals)
     {
-        m_Signals[pSignal->GetName()] = pSignal;
-        m_FrameSignals[pSignal->GetName()] = pSignal;
+        delete pSignal;
     }
 }
 
@@ -45,22 +94,24 @@ void TRACER::TimeFrame::DumpAndClear()
     {
         DumpLine('#' + std::to_string(m_Timestamp.GetValue()));
 
-        for (const auto &signal : m_FrameSignals)
+        std::sort(m_FrameSignals.begin(), m_FrameSignals.end());
+        for (const size_t index : m_FrameSignals)
         {
-            DumpLine(signal.second->Print());
+            DumpLine(m_Signals[index]->Print());
         }
 
         m_FrameSignals.clear();
+        ++m_Generation;
     }
 }
 
-bool TRACER::TimeFrame::WasSignalValueAdded(const SIGNAL::Signal *pSignal)
+bool TRACER::TimeFrame::WasSignalValueAdded(size_t index, const SIGNAL::Signal *pSignal) const
 {
-    const auto it = m_Signals.find(pSignal->GetName());
+    const SIGNAL::Signal *pLastSignal = m_Signals[index];
 
-    if (it != m_Signals.end())
+    if (pLastSignal != nullptr)
     {
-        return (*it->second != *pSignal);
+        return (*pLastSignal != *pSignal);
     }
     else
     {
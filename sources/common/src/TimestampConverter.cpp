@@ -0,0 +1,252 @@
+/// @file common/src/TimestampConverter.cpp
+///
+/// The timestamp converter.
+///
+/// @par Full Description
+/// The converter parses the fixed-format timestamps directly into the log time base.
+///
+/// @ingroup Utils
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <array>
+#include <limits>
+
+#include "TimestampConverter.h"
+#include "TimeUnit.h"
+
+UTILS::ConversionStatus UTILS::TimestampConverter::ConvertTimeOfDay(std::string_view text, size_t timeBase, uint64_t &rValue)
+{
+    size_t position = SkipSpaces(text, 0);
+    uint64_t hours = 0;
+    uint64_t minutes = 0;
+    uint64_t seconds = 0;
+
+    // The minutes and the seconds have the fixed widths.
+    if ((ConversionStatus::OK != ConvertDigits(text, position, 2, hours)) ||
+        (position >= text.size()) || (':' != text[position]))
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    const size_t minutesStart = ++position;
+    if ((ConversionStatus::OK != ConvertDigits(text, position, 2, minutes)) || (2 != (position - minutesStart)) ||
+        (position >= text.size()) || (':' != text[position]))
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    const size_t secondsStart = ++position;
+    if ((ConversionStatus::OK != ConvertDigits(text, position, 2, seconds)) || (2 != (position - secondsStart)))
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    // The leap second is accepted.
+    if ((hours > 23) || (minutes > 59) || (seconds > 60))
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    const ConversionStatus status =
+        Scale(text, position, (hours * 3600) + (minutes * 60) + seconds, static_cast<int>(3 * timeBase), rValue);
+    return IsEnd(text, position) ? status : ConversionStatus::INVALID;
+}
+
+UTILS::ConversionStatus UTILS::TimestampConverter::ConvertEpoch(std::string_view text, size_t timeBase, uint64_t &rValue)
+{
+    size_t position = SkipSpaces(text, 0);
+    uint64_t seconds = 0;
+
+    const ConversionStatus status = ConvertDigits(text, position, std::numeric_limits<size_t>::max(), seconds);
+    if (ConversionStatus::OK != status)
+    {
+        return status;
+    }
+
+    const ConversionStatus scaleStatus = Scale(text, position, seconds, static_cast<int>(3 * timeBase), rValue);
+    return IsEnd(text, position) ? scaleStatus : ConversionStatus::INVALID;
+}
+
+UTILS::ConversionStatus UTILS::TimestampConverter::ConvertDecimal(std::string_view text, size_t unit, size_t timeBase, uint64_t &rValue)
+{
+    size_t position = SkipSpaces(text, 0);
+    uint64_t integer = 0;
+
+    const ConversionStatus status = ConvertDigits(text, position, std::numeric_limits<size_t>::max(), integer);
+    if (ConversionStatus::OK != status)
+    {
+        return status;
+    }
+
+    // The unit follows the fraction, so the fraction is skipped first.
+    size_t unitPosition = position;
+    if ((unitPosition < text.size()) && ('.' == text[unitPosition]))
+    {
+        ++unitPosition;
+        while ((unitPosition < text.size()) && IsDigit(text[unitPosition]))
+        {
+            ++unitPosition;
+        }
+    }
+
+    // Only the time unit may follow the number.
+    unitPosition = SkipSpaces(text, unitPosition);
+    if (unitPosition < text.size())
+    {
+        const auto &rUnits = TIME::Unit::GetTimeUnits();
+        const size_t suffix = FindUnit(text, unitPosition);
+        if ((suffix >= rUnits.size()) || !IsEnd(text, unitPosition + rUnits[suffix].size()))
+        {
+            return ConversionStatus::INVALID;
+        }
+        unit = suffix;
+    }
+
+    return Scale(text, position, integer, static_cast<int>(3 * timeBase) - static_cast<int>(3 * unit), rValue);
+}
+
+size_t UTILS::TimestampConverter::SkipSpaces(std::string_view text, size_t position)
+{
+    while ((position < text.size()) &&
+           ((' ' == text[position]) || ('\t' == text[position])))
+    {
+        ++position;
+    }
+    return position;
+}
+
+UTILS::ConversionStatus UTILS::TimestampConverter::ConvertDigits(std::string_view text,
+                                                                 size_t &rPosition,
+                                                                 size_t maxDigits,
+                                                                 uint64_t &rValue)
+{
+    const size_t start = rPosition;
+    uint64_t value = 0;
+
+    while ((rPosition < text.size()) && IsDigit(text[rPosition]) && ((rPosition - start) < maxDigits))
+    {
+        const uint64_t digit = static_cast<uint64_t>(text[rPosition] - '0');
+        if (value > ((std::numeric_limits<uint64_t>::max() - digit) / 10))
+        {
+            return ConversionStatus::OUT_OF_RANGE;
+        }
+        value = (value * 10) + digit;
+        ++rPosition;
+    }
+
+    if (start == rPosition)
+    {
+        return ConversionStatus::INVALID;
+    }
+
+    rValue = value;
+    return ConversionStatus::OK;
+}
+
+UTILS::ConversionStatus UTILS::TimestampConverter::Scale(std::string_view text,
+                                                         size_t &rPosition,
+                                                         uint64_t integer,
+                                                         int exponent,
+                                                         uint64_t &rValue)
+{
+    // The powers of ten up to the femtoseconds in seconds.
+    static const std::array<uint64_t, 16> TEN_POWER =
+        {
+            1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+            100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+            10000000000000ull, 100000000000000ull, 1000000000000000ull
+        };
+
+    // The fraction digits are only significant above the time base.
+    uint64_t fraction = 0;
+    size_t fractionDigits = 0;
+    if ((rPosition < text.size()) && ('.' == text[rPosition]))
+    {
+        const size_t start = ++rPosition;
+        while ((rPosition < text.size()) && IsDigit(text[rPosition]))
+        {
+            if ((exponent > 0) && (fractionDigits < static_cast<size_t>(exponent)))
+            {
+                fraction = (fraction * 10) + static_cast<uint64_t>(text[rPosition] - '0');
+                ++fractionDigits;
+            }
+            ++rPosition;
+        }
+
+        if (start == rPosition)
+        {
+            return ConversionStatus::INVALID;
+        }
+    }
+
+    if (exponent < 0)
+    {
+        rValue = integer / TEN_POWER[static_cast<size_t>(-exponent)];
+        return ConversionStatus::OK;
+    }
+
+    const uint64_t scale = TEN_POWER[static_cast<size_t>(exponent)];
+    if (integer > (std::numeric_limits<uint64_t>::max() / scale))
+    {
+        return ConversionStatus::OUT_OF_RANGE;
+    }
+
+    const uint64_t value = integer * scale;
+    fraction *= TEN_POWER[static_cast<size_t>(exponent) - fractionDigits];
+    if (value > (std::numeric_limits<uint64_t>::max() - fraction))
+    {
+        return ConversionStatus::OUT_OF_RANGE;
+    }
+
+    rValue = value + fraction;
+    return ConversionStatus::OK;
+}
+
+size_t UTILS::TimestampConverter::FindUnit(std::string_view text, size_t position)
+{
+    const auto &rUnits = TIME::Unit::GetTimeUnits();
+    size_t found = rUnits.size();
+
+    // The longest unit wins, e.g. 'ms' over 's'.
+    for (size_t unit = 0; unit < rUnits.size(); ++unit)
+    {
+        const std::string_view name = rUnits[unit];
+        if ((0 == text.compare(position, name.size(), name)) &&
+            ((found == rUnits.size()) || (name.size() > rUnits[found].size())))
+        {
+            found = unit;
+        }
+    }
+
+    // The unit must not be a part of a word.
+    if (found < rUnits.size())
+    {
+        const size_t end = position + rUnits[found].size();
+        if ((end < text.size()) &&
+            (((text[end] >= 'a') && (text[end] <= 'z')) || ((text[end] >= 'A') && (text[end] <= 'Z'))))
+        {
+            return rUnits.size();
+        }
+    }
+
+    return found;
+}
@@ -60,48 +60,19 @@ void PARSER::TxtParser::Parse()
     // Line counter.
     INSTRUMENT::Instrument::LineNumberT lineNumber = 1;
 
+    // The log may be parsed more than once.
+    m_ValidLines = 0;
+    m_InvalidLines = 0;
+
     // Process the log file.
+    // The buffers are reused for all the lines.
     std::string input_line;
+    std::vector<SIGNAL::Signal *> vpSignals;
     while (std::getline(m_LogFile, input_line))
     {
-        std::vector<const SIGNAL::Signal *> vpSignals =
-            m_rSignalFactory.Create(input_line, lineNumber, m_SourceHandle);
-        const SIGNAL::Signal *pSignal = nullptr;
-
-        if (!vpSignals.empty())
+        if (0 != m_rSignalFactory.Create(input_line, lineNumber, m_SourceHandle, vpSignals))
         {
-            while (!vpSignals.empty())
-            {
-                try
-                {
-                    pSignal = vpSignals.back();
-                    vpSignals.pop_back();
-                    m_pSignalDb->Add(pSignal);
-                }
-                catch (const EXCEPTION::VcdException &rException)
-                {
-                    delete pSignal;
-                    while (!vpSignals.empty())
-                    {
-                        delete vpSignals.back();
-                        vpSignals.pop_back();
-                    }
-                    if (EXCEPTION::Error::INCONSISTENT_SIGNAL == rException.GetId())
-                    {
-                        throw EXCEPTION::VcdException(rException.GetId(), std::string(rException.what()) +
-                                                      " At line " + std::to_string(lineNumber) + ".");
-                    }
-                    else
-                    {
-                        throw rException;
-                    }
-                }
-
-                for (auto instrument : m_vpInstruments)
-                {
-                    instrument->Notify(lineNumber, *pSignal);
-                }
-            }
+            AddSignals(vpSignals, lineNumber);
             ++m_ValidLines;
         }
         else
@@ -53,3 +53,21 @@ std::vector<std::string> UTILS::Split(const std::string &rInString,
 
     return outStrings;
 }
+
+bool UTILS::ConvertDelimiter(const std::string &rDescription,
+                             char &rDelimiter)
+{
+    if ("\\t" == rDescription)
+    {
+        rDelimiter = '\t';
+        return true;
+    }
+
+    if (1 == rDescription.size())
+    {
+        rDelimiter = rDescription[0];
+        return true;
+    }
+
+    return false;
+}
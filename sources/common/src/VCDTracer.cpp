@@ -36,23 +36,63 @@
 
 #include "VCDTracer.h"
 #include "SignalStructureBuilder.h"
-#include "TimeFrame.h"
 #include "Version.h"
+#include "VcdException.h"
 
 TRACER::VCDTracer::VCDTracer(const std::string &outputFile,
-                             const SIGNAL::SignalDb &signalDb) :
+                             SIGNAL::SignalDb &signalDb) :
     m_File(outputFile, std::ifstream::out | std::ifstream::binary),
-    m_rSignalDb(signalDb)
+    m_rSignalDb(signalDb),
+    m_pStreamFrame(),
+    m_StreamTimestamp(0)
 {
 
 }
 
 void TRACER::VCDTracer::Dump()
 {
+    // Order the signals.
+    m_rSignalDb.Finalize();
+
     GenerateHeader();
     GenerateBody();
 }
 
+void TRACER::VCDTracer::Begin()
+{
+    GenerateHeader();
+    StartStream();
+}
+
+void TRACER::VCDTracer::Consume(SIGNAL::Signal *pSignal)
+{
+    const TIME::Timestamp timestamp = pSignal->GetTimestamp();
+
+    if (timestamp < m_StreamTimestamp)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::UNSORTED_SIGNAL,
+                                      "Unsorted signal: " + pSignal->GetName() +
+                                      ". Timestamp " + std::to_string(timestamp.GetValue()) +
+                                      " follows " + std::to_string(m_StreamTimestamp.GetValue()) + ".");
+    }
+
+    if (timestamp != m_StreamTimestamp)
+    {
+        m_pStreamFrame->DumpAndClear();
+
+        m_StreamTimestamp = timestamp;
+        m_pStreamFrame->SetTime(timestamp);
+    }
+
+    m_pStreamFrame->Add(pSignal);
+}
+
+void TRACER::VCDTracer::End()
+{
+    m_pStreamFrame->DumpAndClear();
+    m_pStreamFrame.reset();
+}
+
 void TRACER::VCDTracer::GenerateHeader()
 {
     // So as to make things simpler the header has been split into three
@@ -96,7 +136,17 @@ void TRACER::VCDTracer::GenerateSignalDefaults()
 
 void TRACER::VCDTracer::GenerateBody()
 {
-    TimeFrame frame(0, m_File);
+    if (m_rSignalDb.HasSpilledSignals())
+    {
+        // Trace the signals merged from the spilled runs.
+        StartStream();
+        m_rSignalDb.Replay(*this);
+        End();
+
+        return;
+    }
+
+    TimeFrame frame(0, m_rSignalDb.GetSignalFootprint(), m_File);
     TIME::Timestamp previous_timestamp = 0;
 
     for (const SIGNAL::Signal *current_signal : m_rSignalDb.GetSignals())
@@ -117,6 +167,15 @@ void TRACER::VCDTracer::GenerateBody()
     frame.DumpAndClear();
 }
 
+void TRACER::VCDTracer::StartStream()
+{
+    m_StreamTimestamp = 0;
+    m_pStreamFrame = std::make_unique<TimeFrame>(m_StreamTimestamp,
+                                                 m_rSignalDb.GetSignalFootprint(),
+                                                 m_File,
+                                                 true);
+}
+
 std::string TRACER::VCDTracer::GetTimeAndDate() const
 {
     auto now = std::chrono::system_clock::now();
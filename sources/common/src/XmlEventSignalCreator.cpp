@@ -27,20 +27,19 @@
 #include "XmlEventSignalCreator.h"
 #include "EventSignal.h"
 
-SIGNAL::Signal *PARSER::XmlEventSignalCreator::Create(const std::string &rLogLine,
-                                                      INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                                      SIGNAL::SourceRegistry::HandleT sourceHandle) const
+void PARSER::XmlEventSignalCreator::Emit(const CaptureGroups &rGroups,
+                                         CaptureCache &rCache,
+                                         INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                         SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                         CreationSink &rSink) const
 {
-    std::smatch result;
-
-    if (std::regex_search(rLogLine, result, m_SignalRegEx))
-    {
-        return new SIGNAL::EventSignal(GetName(result),
-                                       GetTimestamp(result, lineNumber),
-                                       sourceHandle);
-    }
-    else
+    TIME::Timestamp timestamp = 0;
+    if (!GetTimestamp(rGroups, rCache, lineNumber, rSink, timestamp))
     {
-        return nullptr;
+        return;
     }
+
+    rSink.AddSignal(new SIGNAL::EventSignal(GetName(rGroups, rCache),
+                                            timestamp,
+                                            sourceHandle));
 }
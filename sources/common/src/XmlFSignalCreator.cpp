@@ -27,21 +27,20 @@
 #include "XmlFSignalCreator.h"
 #include "FSignal.h"
 
-SIGNAL::Signal *PARSER::XmlFSignalCreator::Create(const std::string &rLogLine,
-                                                  INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                                  SIGNAL::SourceRegistry::HandleT sourceHandle) const
+void PARSER::XmlFSignalCreator::Emit(const CaptureGroups &rGroups,
+                                     CaptureCache &rCache,
+                                     INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                     SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                     CreationSink &rSink) const
 {
-    std::smatch result;
-
-    if (true == std::regex_search(rLogLine, result, m_SignalRegEx))
-    {
-        return new SIGNAL::FSignal(GetName(result),
-                                   GetTimestamp(result, lineNumber),
-                                   GetFloatValue(result),
-                                   sourceHandle);
-    }
-    else
+    TIME::Timestamp timestamp = 0;
+    if (!GetTimestamp(rGroups, rCache, lineNumber, rSink, timestamp))
     {
-        return nullptr;
+        return;
     }
+
+    rSink.AddSignal(new SIGNAL::FSignal(GetName(rGroups, rCache),
+                                        timestamp,
+                                        GetFloatValue(rGroups, rCache),
+                                        sourceHandle));
 }
@@ -0,0 +1,89 @@
+/// @file common/src/XmlFieldsSignalCreator.cpp
+///
+/// The XML delimiter-separated fields signal creator.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+
+#include <cstring>
+
+#include "XmlFieldsSignalCreator.h"
+
+bool PARSER::XmlFieldsSignalCreator::Create(const std::string &rLogLine,
+                                            INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                            SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                            CreationSink &rSink) const
+{
+    if (!Split(rLogLine))
+    {
+        return false;
+    }
+
+    for (const Guard &rGuard : m_Guards)
+    {
+        if (m_Fields[rGuard.m_Field] != rGuard.m_Literal)
+        {
+            return false;
+        }
+    }
+
+    EmitSignals(CaptureGroups(m_Fields.data(), m_Fields.size()), lineNumber, sourceHandle, rSink);
+    return true;
+}
+
+bool PARSER::XmlFieldsSignalCreator::Split(const std::string &rLogLine) const
+{
+    std::string_view line(rLogLine);
+
+    // The same line endings as of the regular expressions are accepted.
+    if (!line.empty() && ('\r' == line.back()))
+    {
+        line.remove_suffix(1);
+    }
+
+    m_Fields.clear();
+    m_Fields.push_back(line);
+
+    size_t start = 0;
+    for (;;)
+    {
+        // The line has more fields than expected.
+        if (m_Fields.size() > m_FieldCount)
+        {
+            return false;
+        }
+
+        const void *pDelimiter = std::memchr(line.data() + start, m_Delimiter, line.size() - start);
+        if (nullptr == pDelimiter)
+        {
+            m_Fields.push_back(line.substr(start));
+            break;
+        }
+
+        const size_t end = static_cast<size_t>(static_cast<const char *>(pDelimiter) - line.data());
+        m_Fields.push_back(line.substr(start, end - start));
+        start = end + 1;
+    }
+
+    return (m_Fields.size() == (m_FieldCount + 1));
+}
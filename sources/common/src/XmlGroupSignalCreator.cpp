@@ -0,0 +1,99 @@
+/// @file common/src/XmlGroupSignalCreator.cpp
+///
+/// The XML group signal creator.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include "XmlGroupSignalCreator.h"
+#include "XmlISignalCreator.h"
+#include "XmlFSignalCreator.h"
+#include "XmlEventSignalCreator.h"
+
+void PARSER::XmlGroupSignalCreator::AddVector(const std::string &rTimestamp,
+                                              const std::string &rName,
+                                              const std::string &rValue,
+                                              const std::string &rSize,
+                                              const TimestampFormat &rTimestampFormat)
+{
+    std::shared_ptr<XmlISignalCreator> pSignal = std::make_shared<XmlISignalCreator>(m_RegEx,
+                                                                                     rTimestamp,
+                                                                                     rName,
+                                                                                     rValue,
+                                                                                     rSize,
+                                                                                     m_pSignalRegEx);
+    pSignal->SetTimestampFormat(rTimestampFormat);
+    m_vpSignals.push_back(pSignal);
+}
+
+void PARSER::XmlGroupSignalCreator::AddReal(const std::string &rTimestamp,
+                                            const std::string &rName,
+                                            const std::string &rValue,
+                                            const TimestampFormat &rTimestampFormat)
+{
+    std::shared_ptr<XmlFSignalCreator> pSignal = std::make_shared<XmlFSignalCreator>(m_RegEx,
+                                                                                     rTimestamp,
+                                                                                     rName,
+                                                                                     rValue,
+                                                                                     m_pSignalRegEx);
+    pSignal->SetTimestampFormat(rTimestampFormat);
+    m_vpSignals.push_back(pSignal);
+}
+
+void PARSER::XmlGroupSignalCreator::AddEvent(const std::string &rTimestamp,
+                                             const std::string &rName,
+                                             const TimestampFormat &rTimestampFormat)
+{
+    std::shared_ptr<XmlEventSignalCreator> pSignal = std::make_shared<XmlEventSignalCreator>(m_RegEx,
+                                                                                             rTimestamp,
+                                                                                             rName,
+                                                                                             m_pSignalRegEx);
+    pSignal->SetTimestampFormat(rTimestampFormat);
+    m_vpSignals.push_back(pSignal);
+}
+
+bool PARSER::XmlGroupSignalCreator::Create(const std::string &rLogLine,
+                                           INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                           SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                           CreationSink &rSink) const
+{
+    if (!std::regex_search(rLogLine, m_Match, *m_pSignalRegEx))
+    {
+        return false;
+    }
+
+    EmitSignals(CaptureGroups(m_Match), lineNumber, sourceHandle, rSink);
+    return true;
+}
+
+void PARSER::XmlGroupSignalCreator::EmitSignals(const CaptureGroups &rGroups,
+                                                INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                                SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                                CreationSink &rSink) const
+{
+    // All the signals of the line share the converted groups.
+    m_CaptureCache.Reset();
+    for (const auto &signal : m_vpSignals)
+    {
+        signal->Emit(rGroups, m_CaptureCache, lineNumber, sourceHandle, rSink);
+    }
+}
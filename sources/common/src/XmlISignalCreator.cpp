@@ -27,22 +27,22 @@
 #include "XmlISignalCreator.h"
 #include "ISignal.h"
 
-SIGNAL::Signal *PARSER::XmlISignalCreator::Create(const std::string &rLogLine,
-                                                  INSTRUMENT::Instrument::LineNumberT lineNumber,
-                                                  SIGNAL::SourceRegistry::HandleT sourceHandle) const
+void PARSER::XmlISignalCreator::Emit(const CaptureGroups &rGroups,
+                                     CaptureCache &rCache,
+                                     INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                     SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                     CreationSink &rSink) const
 {
-    std::smatch result;
-
-    if (true == std::regex_search(rLogLine, result, m_SignalRegEx))
-    {
-        return new SIGNAL::ISignal(GetName(result),
-                                   GetSize(result),
-                                   GetTimestamp(result, lineNumber),
-                                   GetDecimalValue(result).GetValue(),
-                                   sourceHandle);
-    }
-    else
+    TIME::Timestamp timestamp = 0;
+    if (!GetTimestamp(rGroups, rCache, lineNumber, rSink, timestamp))
     {
-        return nullptr;
+        return;
     }
+
+    CreateVector(GetName(rGroups, rCache),
+                 GetSize(rGroups, rCache),
+                 timestamp,
+                 GetDecimalValue(rGroups, rCache).GetValue(),
+                 sourceHandle,
+                 rSink);
 }
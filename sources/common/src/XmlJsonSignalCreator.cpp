@@ -0,0 +1,55 @@
+/// @file common/src/XmlJsonSignalCreator.cpp
+///
+/// The XML JSON signal creator.
+///
+/// @par Full Description
+/// The class provides means to create XML signal objects from
+/// the JSON log lines.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include "XmlJsonSignalCreator.h"
+
+bool PARSER::XmlJsonSignalCreator::Create(const std::string &rLogLine,
+                                          INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                          SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                          CreationSink &rSink) const
+{
+    if (!m_Extractor.Extract(rLogLine))
+    {
+        return false;
+    }
+
+    const std::vector<std::string_view> &rValues = m_Extractor.GetValues();
+
+    for (const Guard &rGuard : m_Guards)
+    {
+        if (rValues[rGuard.m_Value] != rGuard.m_Literal)
+        {
+            return false;
+        }
+    }
+
+    EmitSignals(CaptureGroups(rValues.data(), rValues.size()), lineNumber, sourceHandle, rSink);
+    return true;
+}
@@ -25,34 +25,115 @@
 /// IN THE SOFTWARE.
 
 #include "XmlSignalCreator.h"
+#include "EvaluatorExceptions.h"
+#include "TimestampConverter.h"
 
-TIME::Timestamp PARSER::XmlSignalCreator::GetTimestamp(const std::smatch &rMatch,
-                                                       INSTRUMENT::Instrument::LineNumberT lineNumber) const
+bool PARSER::XmlSignalCreator::Create(const std::string &rLogLine,
+                                      INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                      SIGNAL::SourceRegistry::HandleT sourceHandle,
+                                      CreationSink &rSink) const
 {
-    m_TimestampEvaluator.SetContext(&rMatch, lineNumber);
-    return m_TimestampEvaluator.EvaluateUint();
+    if (!std::regex_search(rLogLine, m_Match, *m_pSignalRegEx))
+    {
+        return false;
+    }
+
+    // The groups converted for the previous line are invalidated.
+    m_CaptureCache.Reset();
+    Emit(CaptureGroups(m_Match), m_CaptureCache, lineNumber, sourceHandle, rSink);
+    return true;
+}
+
+bool PARSER::XmlSignalCreator::GetTimestamp(const CaptureGroups &rGroups,
+                                            CaptureCache &rCache,
+                                            INSTRUMENT::Instrument::LineNumberT lineNumber,
+                                            CreationSink &rSink,
+                                            TIME::Timestamp &rTimestamp) const
+{
+    if (TimestampFormat::Kind::EXPRESSION != m_TimestampFormat.m_Kind)
+    {
+        return ConvertTimestamp(rGroups, rSink, rTimestamp);
+    }
+
+    const ExpressionContext context(&rGroups, lineNumber, &rCache);
+    rTimestamp = m_pTimestampEvaluator->EvaluateUint(context);
+    return true;
+}
+
+std::string PARSER::XmlSignalCreator::GetName(const CaptureGroups &rGroups, CaptureCache &rCache) const
+{
+    const ExpressionContext context(&rGroups, 0, &rCache);
+    return m_pNameEvaluator->EvaluateString(context);
 }
 
-std::string PARSER::XmlSignalCreator::GetName(const std::smatch &rMatch) const
+SafeUInt<uint64_t> PARSER::XmlSignalCreator::GetDecimalValue(const CaptureGroups &rGroups, CaptureCache &rCache) const
 {
-    m_NameEvaluator.SetContext(&rMatch, 0);
-    return m_NameEvaluator.EvaluateString();
+    const ExpressionContext context(&rGroups, 0, &rCache);
+    return m_pDecimalEvaluator->EvaluateUint(context);
 }
 
-SafeUInt<uint64_t> PARSER::XmlSignalCreator::GetDecimalValue(const std::smatch &rMatch) const
+std::string PARSER::XmlSignalCreator::GetFloatValue(const CaptureGroups &rGroups, CaptureCache &rCache) const
 {
-    m_DecimalEvaluator.SetContext(&rMatch, 0);
-    return m_DecimalEvaluator.EvaluateUint();
+    const ExpressionContext context(&rGroups, 0, &rCache);
+    return m_pFloatEvaluator->EvaluateDouble(context);
 }
 
-std::string PARSER::XmlSignalCreator::GetFloatValue(const std::smatch &rMatch) const
+size_t PARSER::XmlSignalCreator::GetSize(const CaptureGroups &rGroups, CaptureCache &rCache) const
 {
-    m_FloatEvaluator.SetContext(&rMatch, 0);
-    return m_FloatEvaluator.EvaluateDouble();
+    const ExpressionContext context(&rGroups, 0, &rCache);
+    return static_cast<size_t>(m_pSizeEvaluator->EvaluateUint(context));
 }
 
-size_t PARSER::XmlSignalCreator::GetSize(const std::smatch &rMatch) const
+bool PARSER::XmlSignalCreator::ConvertTimestamp(const CaptureGroups &rGroups,
+                                                CreationSink &rSink,
+                                                TIME::Timestamp &rTimestamp) const
 {
-    m_SizeEvaluator.SetContext(&rMatch, 0);
-    return static_cast<size_t>(m_SizeEvaluator.EvaluateUint());
+    if (m_TimestampFormat.m_Group >= rGroups.GetSize())
+    {
+        throw EXCEPTIONS::IndexOutOfRange("Regex group index out of range: " + std::to_string(m_TimestampFormat.m_Group));
+    }
+
+    const std::string_view text = rGroups.GetGroup(m_TimestampFormat.m_Group);
+    uint64_t timestamp = 0;
+    UTILS::ConversionStatus status = UTILS::ConversionStatus::INVALID;
+    const char *pConversionError = "";
+
+    switch (m_TimestampFormat.m_Kind)
+    {
+        case TimestampFormat::Kind::TIME_OF_DAY:
+            status = UTILS::TimestampConverter::ConvertTimeOfDay(text, m_TimestampFormat.m_TimeBase, timestamp);
+            pConversionError = "Cannot convert the time of day: ";
+            break;
+
+        case TimestampFormat::Kind::EPOCH:
+            status = UTILS::TimestampConverter::ConvertEpoch(text, m_TimestampFormat.m_TimeBase, timestamp);
+            pConversionError = "Cannot convert the epoch time: ";
+            break;
+
+        default:
+            status = UTILS::TimestampConverter::ConvertDecimal(text,
+                                                               m_TimestampFormat.m_Unit,
+                                                               m_TimestampFormat.m_TimeBase,
+                                                               timestamp);
+            pConversionError = "Cannot convert the decimal time: ";
+            break;
+    }
+
+    // A malformed timestamp drops the signal of the line only.
+    if (UTILS::ConversionStatus::INVALID == status)
+    {
+        rSink.AddWarning(EXCEPTION::Warning::INVALID_TIMESTAMP,
+                         pConversionError + std::string(text) + ". Dropping the signal.");
+        return false;
+    }
+
+    if (UTILS::ConversionStatus::OUT_OF_RANGE == status)
+    {
+        rSink.AddWarning(EXCEPTION::Warning::INVALID_TIMESTAMP,
+                         "Out of range timestamp: " + std::string(text) + ". Dropping the signal.");
+        return false;
+    }
+
+    rTimestamp = timestamp;
+    return true;
 }
@@ -31,12 +31,20 @@
 #include "XmlSignalFactory.h"
 #include "XmlEventSignalCreator.h"
 #include "XmlFSignalCreator.h"
+#include "XmlFieldsSignalCreator.h"
+#include "XmlGroupSignalCreator.h"
 #include "XmlISignalCreator.h"
+#include "XmlJsonSignalCreator.h"
 #include "VcdException.h"
+#include "NumberConverter.h"
+#include "TimeUnit.h"
+#include "Utils.h"
 
 PARSER::XmlDescription::XmlDescription(const pugi::xml_node &rNode) :
     m_RegexLine(),
     m_Timestamp(),
+    m_TimestampFormat(),
+    m_TimestampUnit(),
     m_Name(),
     m_Value(),
     m_Size()
@@ -51,6 +59,8 @@ PARSER::XmlDescription::XmlDescription(const pugi::xml_node &rNode) :
         if (0 == std::strcmp("timestamp", tag.name()))
         {
             m_Timestamp = tag.child_value();
+            m_TimestampFormat = tag.attribute("format").value();
+            m_TimestampUnit = tag.attribute("unit").value();
         }
 
         if (0 == std::strcmp("name", tag.name()))
@@ -90,6 +100,54 @@ const std::string &PARSER::XmlDescription::GetTimestamp() const
                                   "XML - No timestamp expression.");
 }
 
+PARSER::TimestampFormat PARSER::XmlDescription::GetTimestampFormat(size_t timeBase) const
+{
+    TimestampFormat format{TimestampFormat::Kind::EXPRESSION, 0, timeBase, timeBase};
+
+    if (m_TimestampFormat.empty() || ("expression" == m_TimestampFormat))
+    {
+        return format;
+    }
+    else if ("time" == m_TimestampFormat)
+    {
+        format.m_Kind = TimestampFormat::Kind::TIME_OF_DAY;
+    }
+    else if ("epoch" == m_TimestampFormat)
+    {
+        format.m_Kind = TimestampFormat::Kind::EPOCH;
+    }
+    else if ("decimal" == m_TimestampFormat)
+    {
+        format.m_Kind = TimestampFormat::Kind::DECIMAL;
+    }
+    else
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_TIMESTAMP_FORMAT,
+                                      "XML - Invalid timestamp format: '" + m_TimestampFormat + "'");
+    }
+
+    // The decimal timestamps are given in the log time base by default.
+    if (!m_TimestampUnit.empty())
+    {
+        if ((TimestampFormat::Kind::DECIMAL != format.m_Kind) || !TIME::Unit::IsTimeUnitValid(m_TimestampUnit))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_TIMESTAMP_FORMAT,
+                                          "XML - Invalid timestamp unit: '" + m_TimestampUnit + "'");
+        }
+        format.m_Unit = TIME::Unit::GetTimeUnitIndex(m_TimestampUnit);
+    }
+
+    uint64_t group = 0;
+    if (UTILS::ConversionStatus::OK != UTILS::NumberConverter::ConvertDecimal(GetTimestamp(), group))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_TIMESTAMP_FORMAT,
+                                      "XML - Invalid timestamp group: '" + m_Timestamp + "'");
+    }
+    format.m_Group = static_cast<size_t>(group);
+
+    return format;
+}
+
 const std::string &PARSER::XmlDescription::GetName() const
 {
     if (!m_Name.empty())
@@ -120,8 +178,9 @@ const std::string &PARSER::XmlDescription::GetSize() const
                                   "XML - No size expression.");
 }
 
-PARSER::XmlSignalFactory::XmlSignalFactory(const std::string &rXmlFileName) :
-    SignalFactory()
+PARSER::XmlSignalFactory::XmlSignalFactory(const std::string &rXmlFileName, const std::string &rTimeBase) :
+    SignalFactory(),
+    m_TimeBase(TIME::Unit::GetTimeUnitIndex(rTimeBase))
 {
     // Parse the XML and add signal creators.
     pugi::xml_document doc;
@@ -133,6 +192,9 @@ PARSER::XmlSignalFactory::XmlSignalFactory(const std::string &rXmlFileName) :
 
     pugi::xml_node signals = doc.child("signals");
 
+    // The user declares if a log line can be matched by one signal description only.
+    m_Exclusive = signals.attribute("exclusive").as_bool();
+
     try
     {
         // Traverse the XML.
@@ -141,24 +203,45 @@ PARSER::XmlSignalFactory::XmlSignalFactory(const std::string &rXmlFileName) :
             std::unique_ptr<XmlDescription> description = std::make_unique<XmlDescription>(signal);
             if (0 == std::strcmp("vector", signal.name()))
             {
-                m_vpSignalCreators.push_back(std::make_unique<XmlISignalCreator>(description->GetRegex(),
-                                             description->GetTimestamp(),
-                                             description->GetName(),
-                                             description->GetValue(),
-                                             description->GetSize()));
+                const TimestampFormat timestampFormat = description->GetTimestampFormat(m_TimeBase);
+                std::unique_ptr<XmlSignalCreator> pCreator = std::make_unique<XmlISignalCreator>(description->GetRegex(),
+                                                             description->GetTimestamp(),
+                                                             description->GetName(),
+                                                             description->GetValue(),
+                                                             description->GetSize());
+                pCreator->SetTimestampFormat(timestampFormat);
+                m_vpSignalCreators.push_back(std::move(pCreator));
             }
             else if (0 == std::strcmp("real", signal.name()))
             {
-                m_vpSignalCreators.push_back(std::make_unique<XmlFSignalCreator>(description->GetRegex(),
-                                             description->GetTimestamp(),
-                                             description->GetName(),
-                                             description->GetValue()));
+                const TimestampFormat timestampFormat = description->GetTimestampFormat(m_TimeBase);
+                std::unique_ptr<XmlSignalCreator> pCreator = std::make_unique<XmlFSignalCreator>(description->GetRegex(),
+                                                             description->GetTimestamp(),
+                                                             description->GetName(),
+                                                             description->GetValue());
+                pCreator->SetTimestampFormat(timestampFormat);
+                m_vpSignalCreators.push_back(std::move(pCreator));
             }
             else if (0 == std::strcmp("event", signal.name()))
             {
-                m_vpSignalCreators.push_back(std::make_unique<XmlEventSignalCreator>(description->GetRegex(),
-                                             description->GetTimestamp(),
-                                             description->GetName()));
+                const TimestampFormat timestampFormat = description->GetTimestampFormat(m_TimeBase);
+                std::unique_ptr<XmlSignalCreator> pCreator = std::make_unique<XmlEventSignalCreator>(description->GetRegex(),
+                                                             description->GetTimestamp(),
+                                                             description->GetName());
+                pCreator->SetTimestampFormat(timestampFormat);
+                m_vpSignalCreators.push_back(std::move(pCreator));
+            }
+            else if (0 == std::strcmp("group", signal.name()))
+            {
+                m_vpSignalCreators.push_back(CreateGroup(signal));
+            }
+            else if (0 == std::strcmp("fields", signal.name()))
+            {
+                m_vpSignalCreators.push_back(CreateFields(signal));
+            }
+            else if (0 == std::strcmp("json", signal.name()))
+            {
+                m_vpSignalCreators.push_back(CreateJson(signal));
             }
             else
             {
@@ -173,3 +256,156 @@ PARSER::XmlSignalFactory::XmlSignalFactory(const std::string &rXmlFileName) :
                                       "Parsing error in " + rXmlFileName + ":\n" + parsingError.what());
     }
 }
+
+std::unique_ptr<PARSER::SignalCreator> PARSER::XmlSignalFactory::CreateGroup(const pugi::xml_node &rGroup) const
+{
+    const XmlDescription groupDescription(rGroup);
+    std::unique_ptr<XmlGroupSignalCreator> pGroup = std::make_unique<XmlGroupSignalCreator>(groupDescription.GetRegex());
+
+    AddGroupSignals(rGroup, "line", *pGroup);
+
+    return pGroup;
+}
+
+std::unique_ptr<PARSER::SignalCreator> PARSER::XmlSignalFactory::CreateFields(const pugi::xml_node &rFields) const
+{
+    const std::string delimiterDescription = rFields.attribute("delimiter").value();
+    char delimiter = '\0';
+    if (!UTILS::ConvertDelimiter(delimiterDescription, delimiter))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_FIELDS_DESCRIPTION,
+                                      "XML - The fields delimiter must be a single character: '" + delimiterDescription + "'");
+    }
+
+    uint64_t fieldCount = 0;
+    if ((UTILS::ConversionStatus::OK != UTILS::NumberConverter::ConvertDecimal(rFields.attribute("count").value(), fieldCount)) ||
+        (0 == fieldCount))
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_FIELDS_DESCRIPTION,
+                                      "XML - Invalid number of fields: '" + std::string(rFields.attribute("count").value()) + "'");
+    }
+
+    std::unique_ptr<XmlFieldsSignalCreator> pFields =
+        std::make_unique<XmlFieldsSignalCreator>(delimiter, static_cast<size_t>(fieldCount));
+
+    for (const pugi::xml_node &guard : rFields.children())
+    {
+        if (0 == std::strcmp("guard", guard.name()))
+        {
+            uint64_t field = 0;
+            if ((UTILS::ConversionStatus::OK != UTILS::NumberConverter::ConvertDecimal(guard.attribute("field").value(), field)) ||
+                (0 == field) ||
+                (field > fieldCount))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_FIELDS_DESCRIPTION,
+                                              "XML - Invalid guarded field: '" + std::string(guard.attribute("field").value()) + "'");
+            }
+            pFields->AddGuard(static_cast<size_t>(field), guard.child_value());
+        }
+    }
+
+    AddGroupSignals(rFields, "guard", *pFields);
+
+    return pFields;
+}
+
+std::unique_ptr<PARSER::SignalCreator> PARSER::XmlSignalFactory::CreateJson(const pugi::xml_node &rJson) const
+{
+    std::unique_ptr<XmlJsonSignalCreator> pJson = std::make_unique<XmlJsonSignalCreator>();
+    bool hasPaths = false;
+
+    for (const pugi::xml_node &path : rJson.children())
+    {
+        if (0 == std::strcmp("path", path.name()))
+        {
+            hasPaths = true;
+            const size_t value = pJson->AddPath(path.child_value());
+
+            // The value is optionally guarded.
+            const pugi::xml_attribute guard = path.attribute("value");
+            if (guard)
+            {
+                pJson->AddGuard(value, guard.value());
+            }
+        }
+    }
+
+    if (!hasPaths)
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::INVALID_JSON_DESCRIPTION,
+                                      "XML - No JSON paths.");
+    }
+
+    AddGroupSignals(rJson, "path", *pJson);
+
+    return pJson;
+}
+
+void PARSER::XmlSignalFactory::AddGroupSignals(const pugi::xml_node &rGroup,
+                                               const char *pMatchingTag,
+                                               XmlGroupSignalCreator &rCreator) const
+{
+    const XmlDescription groupDescription(rGroup);
+
+    for (const pugi::xml_node &signal : rGroup.children())
+    {
+        const bool isVector = (0 == std::strcmp("vector", signal.name()));
+        const bool isReal = (0 == std::strcmp("real", signal.name()));
+        const bool isEvent = (0 == std::strcmp("event", signal.name()));
+
+        if (!isVector && !isReal && !isEvent)
+        {
+            if ((0 != std::strcmp(pMatchingTag, signal.name())) &&
+                (0 != std::strcmp("timestamp", signal.name())))
+            {
+                throw EXCEPTION::VcdException(EXCEPTION::Error::UNEXPECTED_TAG,
+                                              "XML - Unexpected tag: " + std::string(signal.name()));
+            }
+            continue;
+        }
+
+        const XmlDescription description(signal);
+
+        // The line is matched by the group only.
+        if (signal.child("line"))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::UNEXPECTED_TAG,
+                                          "XML - Unexpected tag: line");
+        }
+
+        // The timestamp of the group is used unless the signal has its own one.
+        const XmlDescription &rTimestampDescription = signal.child("timestamp") ?
+                                                      description :
+                                                      groupDescription;
+        const std::string &rTimestamp = rTimestampDescription.GetTimestamp();
+        const TimestampFormat timestampFormat = rTimestampDescription.GetTimestampFormat(m_TimeBase);
+
+        if (isVector)
+        {
+            rCreator.AddVector(rTimestamp,
+                               description.GetName(),
+                               description.GetValue(),
+                               description.GetSize(),
+                               timestampFormat);
+        }
+        else if (isReal)
+        {
+            rCreator.AddReal(rTimestamp,
+                             description.GetName(),
+                             description.GetValue(),
+                             timestampFormat);
+        }
+        else
+        {
+            rCreator.AddEvent(rTimestamp,
+                              description.GetName(),
+                              timestampFormat);
+        }
+    }
+
+    if (rCreator.IsEmpty())
+    {
+        throw EXCEPTION::VcdException(EXCEPTION::Error::NO_GROUP_SIGNALS,
+                                      "XML - No signals in the group.");
+    }
+}
@@ -0,0 +1,157 @@
+/// @file common/test/benchmark/JsonLines.cpp
+///
+/// Benchmark of the JSON log lines.
+///
+/// @par Full Description
+/// The benchmark compares creating the signals from the JSON log lines
+/// matched with the regular expression of a signal group with extracting
+/// the values of the JSON paths.
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "XmlGroupSignalCreator.h"
+#include "XmlJsonSignalCreator.h"
+#include "SourceRegistry.h"
+
+/// The default number of log lines.
+static const size_t DEFAULT_LINES = 200000;
+
+/// The number of runs of which the best one is reported.
+static const size_t RUNS = 3;
+
+/// Adds the signals of the log line to the creator.
+///
+/// @param rCreator The group or JSON creator.
+static void AddSignals(PARSER::XmlGroupSignalCreator &rCreator)
+{
+    rCreator.AddVector("dec(2)", "\"top.\" + txt(3) + \".raw\"", "hex(4)", "16");
+    rCreator.AddReal("dec(2)", "\"top.\" + txt(3) + \".volt\"", "flt(5)");
+}
+
+/// Returns the best time of creating the signals in milliseconds.
+///
+/// @param rLines The log lines.
+/// @param rCreator The signal creator.
+/// @param sourceHandle The log source handle.
+/// @param rCreated The number of created signals.
+static double Measure(const std::vector<std::string> &rLines,
+                      const PARSER::SignalCreator &rCreator,
+                      SIGNAL::SourceRegistry::HandleT sourceHandle,
+                      size_t &rCreated)
+{
+    double best = 0;
+    std::vector<SIGNAL::Signal *> vpSignals;
+    PARSER::CreationSink sink(vpSignals);
+
+    for (size_t run = 0; run < RUNS; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        rCreated = 0;
+
+        for (size_t line = 0; line < rLines.size(); ++line)
+        {
+            rCreator.Create(rLines[line], line, sourceHandle, sink);
+
+            for (SIGNAL::Signal *pSignal : vpSignals)
+            {
+                delete pSignal;
+                ++rCreated;
+            }
+            vpSignals.clear();
+        }
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if ((0 == run) || (elapsed.count() < best))
+        {
+            best = elapsed.count();
+        }
+    }
+
+    return best;
+}
+
+/// The benchmark entry point.
+int main(int argc, const char *argv[])
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_LINES;
+    const SIGNAL::SourceRegistry::HandleT sourceHandle = SIGNAL::SourceRegistry::GetInstance().Register("benchmark");
+
+    PARSER::XmlGroupSignalCreator groupCreator("\\{\"kind\": \"(adc)\", \"ts\": ([[:d:]]+), \"src\": \\{\"ch\": \"([[:alnum:]]+)\", "
+                                               "\"host\": \"[^\"]*\"\\}, \"raw\": \"([[:xdigit:]]+)\", \"volt\": ([[:d:].]+)\\}");
+    AddSignals(groupCreator);
+
+    PARSER::XmlJsonSignalCreator jsonCreator;
+    jsonCreator.AddGuard(jsonCreator.AddPath("kind"), "adc");
+    jsonCreator.AddPath("ts");
+    jsonCreator.AddPath("src.ch");
+    jsonCreator.AddPath("raw");
+    jsonCreator.AddPath("volt");
+    AddSignals(jsonCreator);
+
+    // Every fourth line is of another kind and creates no signals.
+    std::mt19937_64 generator(2026);
+    std::vector<std::string> lines(count);
+    size_t bytes = 0;
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint64_t random = generator();
+        const char *pKind = (0 == (i % 4)) ? "dac" : "adc";
+        char value[8];
+        std::snprintf(value, sizeof(value), "%x", static_cast<unsigned>(random & 0xffff));
+
+        lines[i] = std::string("{\"kind\": \"") + pKind + "\", \"ts\": " + std::to_string(i) +
+                   ", \"src\": {\"ch\": \"ch" + std::to_string((random >> 16) % 8) + "\", \"host\": \"board-1\"}" +
+                   ", \"raw\": \"" + value + "\", \"volt\": " +
+                   std::to_string((random >> 24) % 4) + '.' + std::to_string((random >> 32) % 1000) + '}';
+        bytes += lines[i].size() + 1;
+    }
+
+    size_t groupCreated = 0;
+    const double groupTime = Measure(lines, groupCreator, sourceHandle, groupCreated);
+
+    size_t jsonCreated = 0;
+    const double jsonTime = Measure(lines, jsonCreator, sourceHandle, jsonCreated);
+
+    std::cout << "Parsing " << count << " lines (" << bytes / 1000000.0 << " MB), best of " << RUNS << " runs [ms]\n"
+              << std::fixed << std::setprecision(1)
+              << std::left << std::setw(16) << "regex" << std::right << std::setw(12) << groupTime << '\n'
+              << std::left << std::setw(16) << "json" << std::right << std::setw(12) << jsonTime << '\n';
+
+    if (groupCreated != jsonCreated)
+    {
+        std::cerr << "The numbers of created signals differ.\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,219 @@
+/// @file common/test/benchmark/NumberConversion.cpp
+///
+/// Benchmark of the number conversion.
+///
+/// @par Full Description
+/// The benchmark compares the former string based conversions with
+/// the NumberConverter class for decimal, hexadecimal and float fields.
+///
+/// @ingroup Benchmark
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "NumberConverter.h"
+
+/// The default number of converted fields.
+static const size_t DEFAULT_FIELDS = 1000000;
+
+/// The number of runs of which the best one is reported.
+static const size_t RUNS = 3;
+
+/// Returns the best time of the conversion function in milliseconds.
+///
+/// @param rFields The converted fields.
+/// @param rConvert The conversion function returning the sum of the values.
+/// @param rSum The sum of the converted values.
+static double Measure(const std::vector<std::string> &rFields,
+                      const std::function<double(const std::vector<std::string> &)> &rConvert,
+                      double &rSum)
+{
+    double best = 0;
+
+    for (size_t run = 0; run < RUNS; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        rSum = rConvert(rFields);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if ((0 == run) || (elapsed.count() < best))
+        {
+            best = elapsed.count();
+        }
+    }
+
+    return best;
+}
+
+/// Runs the benchmark of the integer fields.
+///
+/// @param rName The name of the fields.
+/// @param rFields The converted fields.
+/// @param base The base of the numbers.
+/// @return False if the conversion results differ.
+static bool RunInteger(const std::string &rName, const std::vector<std::string> &rFields, int base)
+{
+    double stollSum = 0;
+    const double stollTime = Measure(rFields,
+                                     [base](const std::vector<std::string> &rConverted)
+    {
+        uint64_t sum = 0;
+        for (const std::string &rField : rConverted)
+        {
+            // The former conversion of a copied regex group.
+            sum += static_cast<uint64_t>(std::stoll(std::string(rField), nullptr, base));
+        }
+        return static_cast<double>(sum);
+    },
+    stollSum);
+
+    double converterSum = 0;
+    const double converterTime = Measure(rFields,
+                                         [base](const std::vector<std::string> &rConverted)
+    {
+        uint64_t sum = 0;
+        for (const std::string &rField : rConverted)
+        {
+            uint64_t value = 0;
+            if (16 == base)
+            {
+                UTILS::NumberConverter::ConvertHex(rField, value);
+            }
+            else
+            {
+                UTILS::NumberConverter::ConvertDecimal(rField, value);
+            }
+            sum += value;
+        }
+        return static_cast<double>(sum);
+    },
+    converterSum);
+
+    std::cout << std::left << std::setw(16) << rName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << stollTime
+              << std::setw(12) << converterTime << '\n';
+
+    return (stollSum == converterSum);
+}
+
+/// Runs the benchmark of the float fields.
+///
+/// @param rName The name of the fields.
+/// @param rFields The converted fields.
+/// @return False if the conversion results differ.
+static bool RunFloat(const std::string &rName, const std::vector<std::string> &rFields)
+{
+    double stodSum = 0;
+    const double stodTime = Measure(rFields,
+                                    [](const std::vector<std::string> &rConverted)
+    {
+        double sum = 0;
+        for (const std::string &rField : rConverted)
+        {
+            sum += std::stod(std::string(rField), nullptr);
+        }
+        return sum;
+    },
+    stodSum);
+
+    double converterSum = 0;
+    const double converterTime = Measure(rFields,
+                                         [](const std::vector<std::string> &rConverted)
+    {
+        double sum = 0;
+        for (const std::string &rField : rConverted)
+        {
+            double value = 0;
+            UTILS::NumberConverter::ConvertFloat(rField, value);
+            sum += value;
+        }
+        return sum;
+    },
+    converterSum);
+
+    std::cout << std::left << std::setw(16) << rName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << stodTime
+              << std::setw(12) << converterTime << '\n';
+
+    return (stodSum == converterSum);
+}
+
+/// The benchmark entry point.
+int main(int argc, const char *argv[])
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_FIELDS;
+
+    std::mt19937_64 generator(2026);
+
+    std::vector<std::string> decimal4(count);
+    std::vector<std::string> decimal16(count);
+    std::vector<std::string> hex8(count);
+    std::vector<std::string> hex15(count);
+    std::vector<std::string> floats(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint64_t random = generator();
+
+        decimal4[i] = std::to_string(random % 10000);
+        decimal16[i] = std::to_string(1000000000000000U + (random % 9000000000000000U));
+
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%08x", static_cast<uint32_t>(random));
+        hex8[i] = buffer;
+        std::snprintf(buffer, sizeof(buffer), "%015llx", static_cast<unsigned long long>(random >> 4));
+        hex15[i] = buffer;
+
+        floats[i] = std::to_string(static_cast<double>(random % 1000000) / 1000.0);
+    }
+
+    std::cout << "Converting " << count << " fields, best of " << RUNS << " runs [ms]\n"
+              << std::left << std::setw(16) << "Fields" << std::right
+              << std::setw(12) << "stoll/stod"
+              << std::setw(12) << "converter" << '\n';
+
+    bool consistent = true;
+
+    consistent &= RunInteger("decimal 4", decimal4, 10);
+    consistent &= RunInteger("decimal 16", decimal16, 10);
+    consistent &= RunInteger("hex 8", hex8, 16);
+    consistent &= RunInteger("hex 15", hex15, 16);
+    consistent &= RunFloat("float", floats);
+
+    if (!consistent)
+    {
+        std::cerr << "Conversion results differ.\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
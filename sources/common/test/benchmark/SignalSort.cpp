@@ -0,0 +1,201 @@
+/// @file common/test/benchmark/SignalSort.cpp
+///
+/// Benchmark of signal sorting.
+///
+/// @par Full Description
+/// Compares the radix sort used by the signal database, run by a single
+/// and by all the hardware threads, with std::stable_sort and with
+/// the std::multiset the database used to keep the signals in.
+/// The timestamps are random, nearly sorted or sorted.
+///
+/// Usage: benchmarkSignalSort [number of signals]
+///
+/// @ingroup Benchmark
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ISignal.h"
+#include "SignalSorter.h"
+
+/// The default number of sorted signals.
+static const size_t DEFAULT_SIGNALS = 1000000;
+
+/// The number of runs of which the best one is reported.
+static const size_t RUNS = 3;
+
+/// The maximum distance by which nearly sorted signals are displaced.
+static const uint64_t DISPLACEMENT = 64;
+
+/// The signals container of the former signal database.
+using MultisetT = std::multiset<const SIGNAL::Signal *, SIGNAL::PtrTimestampLtComparator>;
+
+/// Returns the best time of the sorting function in milliseconds.
+///
+/// @param rSignals The signals to be sorted.
+/// @param rSort The sorting function.
+/// @param rSorted The sorted signals.
+static double Measure(const SIGNAL::SignalCollectionT &rSignals,
+                      const std::function<void(SIGNAL::SignalCollectionT &)> &rSort,
+                      SIGNAL::SignalCollectionT &rSorted)
+{
+    double best = 0;
+
+    for (size_t run = 0; run < RUNS; ++run)
+    {
+        rSorted = rSignals;
+
+        const auto start = std::chrono::steady_clock::now();
+        rSort(rSorted);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if ((0 == run) || (elapsed.count() < best))
+        {
+            best = elapsed.count();
+        }
+    }
+
+    return best;
+}
+
+/// Runs the benchmark of the given timestamps.
+///
+/// @param rName The name of the timestamps distribution.
+/// @param rTimestamps The timestamps of the signals.
+/// @return False if the sorting results differ.
+static bool Run(const std::string &rName, const std::vector<uint64_t> &rTimestamps)
+{
+    std::vector<SIGNAL::ISignal> signals;
+    signals.reserve(rTimestamps.size());
+
+    SIGNAL::SignalCollectionT collection;
+    collection.reserve(rTimestamps.size());
+
+    for (uint64_t timestamp : rTimestamps)
+    {
+        signals.emplace_back("Top.s", 64, timestamp, timestamp, 1);
+        collection.push_back(&signals.back());
+    }
+
+    SIGNAL::SignalCollectionT multisetSorted;
+    const double multisetTime = Measure(collection,
+                                        [](SIGNAL::SignalCollectionT &rSignals)
+    {
+        const MultisetT multiset(rSignals.cbegin(), rSignals.cend());
+        rSignals.assign(multiset.cbegin(), multiset.cend());
+    },
+    multisetSorted);
+
+    SIGNAL::SignalCollectionT stableSorted;
+    const double stableSortTime = Measure(collection,
+                                          [](SIGNAL::SignalCollectionT &rSignals)
+    {
+        std::stable_sort(rSignals.begin(), rSignals.end(), SIGNAL::PtrTimestampLtComparator());
+    },
+    stableSorted);
+
+    SIGNAL::SignalCollectionT radixSorted;
+    const SIGNAL::SignalSorter sorter(1);
+    const double radixSortTime = Measure(collection,
+                                         [&sorter](SIGNAL::SignalCollectionT &rSignals)
+    {
+        sorter.Sort(rSignals);
+    },
+    radixSorted);
+
+    SIGNAL::SignalCollectionT parallelSorted;
+    const SIGNAL::SignalSorter parallelSorter;
+    const double parallelSortTime = Measure(collection,
+                                            [&parallelSorter](SIGNAL::SignalCollectionT &rSignals)
+    {
+        parallelSorter.Sort(rSignals);
+    },
+    parallelSorted);
+
+    std::cout << std::left << std::setw(16) << rName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << multisetTime
+              << std::setw(14) << stableSortTime
+              << std::setw(12) << radixSortTime
+              << std::setw(16) << parallelSortTime << '\n';
+
+    return ((multisetSorted == stableSorted) &&
+            (radixSorted == stableSorted) &&
+            (parallelSorted == stableSorted));
+}
+
+/// The benchmark entry point.
+int main(int argc, const char *argv[])
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_SIGNALS;
+
+    std::mt19937_64 generator(2026);
+
+    std::vector<uint64_t> random(count);
+    std::vector<uint64_t> nearlySorted(count);
+    std::vector<uint64_t> sorted(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        // Nanosecond timestamps over the same time span.
+        random[i] = generator() % (count * 1000);
+
+        // Events logged every microsecond with some of them late.
+        nearlySorted[i] = i * 1000;
+        if (0 == (generator() % 8))
+        {
+            nearlySorted[i] -= std::min<uint64_t>(nearlySorted[i], (generator() % DISPLACEMENT) * 1000);
+        }
+
+        sorted[i] = i * 1000;
+    }
+
+    std::cout << "Sorting " << count << " signals, best of " << RUNS << " runs [ms]\n"
+              << std::left << std::setw(16) << "Timestamps" << std::right
+              << std::setw(12) << "multiset"
+              << std::setw(14) << "stable_sort"
+              << std::setw(12) << "radix"
+              << std::setw(16) << "parallel radix" << '\n';
+
+    bool consistent = true;
+
+    consistent &= Run("random", random);
+    consistent &= Run("nearly sorted", nearlySorted);
+    consistent &= Run("sorted", sorted);
+
+    if (!consistent)
+    {
+        std::cerr << "Sorting results differ.\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,148 @@
+/// @file common/test/benchmark/TimestampLines.cpp
+///
+/// Benchmark of the native timestamp formats.
+///
+/// @par Full Description
+/// The benchmark compares creating the signals timestamped with the time of day
+/// evaluated from the expression of the regex groups with converting the time
+/// of day natively. The native time of day needs no regex groups of its parts,
+/// so the log lines may be split into the fields.
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "XmlGroupSignalCreator.h"
+#include "XmlFieldsSignalCreator.h"
+#include "SourceRegistry.h"
+
+/// The default number of log lines.
+static const size_t DEFAULT_LINES = 200000;
+
+/// The number of runs of which the best one is reported.
+static const size_t RUNS = 3;
+
+/// Returns the best time of creating the signals in milliseconds.
+///
+/// @param rLines The log lines.
+/// @param rCreator The signal creator.
+/// @param sourceHandle The log source handle.
+/// @param rTimestamps The sum of the timestamps of the created signals.
+static double Measure(const std::vector<std::string> &rLines,
+                      const PARSER::SignalCreator &rCreator,
+                      SIGNAL::SourceRegistry::HandleT sourceHandle,
+                      uint64_t &rTimestamps)
+{
+    double best = 0;
+    std::vector<SIGNAL::Signal *> vpSignals;
+    PARSER::CreationSink sink(vpSignals);
+
+    for (size_t run = 0; run < RUNS; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        rTimestamps = 0;
+
+        for (size_t line = 0; line < rLines.size(); ++line)
+        {
+            rCreator.Create(rLines[line], line, sourceHandle, sink);
+
+            for (SIGNAL::Signal *pSignal : vpSignals)
+            {
+                rTimestamps += pSignal->GetTimestamp().GetValue();
+                delete pSignal;
+            }
+            vpSignals.clear();
+        }
+
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if ((0 == run) || (elapsed.count() < best))
+        {
+            best = elapsed.count();
+        }
+    }
+
+    return best;
+}
+
+/// The benchmark entry point.
+int main(int argc, const char *argv[])
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_LINES;
+    const SIGNAL::SourceRegistry::HandleT sourceHandle = SIGNAL::SourceRegistry::GetInstance().Register("benchmark");
+
+    // The timestamps are given in microseconds.
+    PARSER::XmlGroupSignalCreator expressionCreator("^([[:d:]]{2}):([[:d:]]{2}):([[:d:]]{2})\\.([[:d:]]{6}) ([[:alnum:]]+) ([[:xdigit:]]+)$");
+    expressionCreator.AddVector("((dec(1) * 60 + dec(2)) * 60 + dec(3)) * 1000000 + dec(4)",
+                                "\"top.\" + txt(5)", "hex(6)", "16");
+    expressionCreator.AddEvent("((dec(1) * 60 + dec(2)) * 60 + dec(3)) * 1000000 + dec(4)",
+                               "\"top.\" + txt(5) + \".irq\"");
+
+    const PARSER::TimestampFormat timeOfDay{PARSER::TimestampFormat::Kind::TIME_OF_DAY, 1, 2, 2};
+    PARSER::XmlFieldsSignalCreator nativeCreator(' ', 3);
+    nativeCreator.AddVector("1", "\"top.\" + txt(2)", "hex(3)", "16", timeOfDay);
+    nativeCreator.AddEvent("1", "\"top.\" + txt(2) + \".irq\"", timeOfDay);
+
+    std::mt19937_64 generator(2026);
+    std::vector<std::string> lines(count);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        const uint64_t random = generator();
+        char line[64];
+        std::snprintf(line, sizeof(line), "%02u:%02u:%02u.%06u ch%u %x",
+                      static_cast<unsigned>(random % 24),
+                      static_cast<unsigned>((random >> 8) % 60),
+                      static_cast<unsigned>((random >> 16) % 60),
+                      static_cast<unsigned>((random >> 24) % 1000000),
+                      static_cast<unsigned>((random >> 48) % 8),
+                      static_cast<unsigned>((random >> 52) & 0xfff));
+        lines[i] = line;
+    }
+
+    uint64_t expressionTimestamps = 0;
+    const double expressionTime = Measure(lines, expressionCreator, sourceHandle, expressionTimestamps);
+
+    uint64_t nativeTimestamps = 0;
+    const double nativeTime = Measure(lines, nativeCreator, sourceHandle, nativeTimestamps);
+
+    std::cout << "Parsing " << count << " lines, best of " << RUNS << " runs [ms]\n"
+              << std::fixed << std::setprecision(1)
+              << std::left << std::setw(16) << "expression" << std::right << std::setw(12) << expressionTime << '\n'
+              << std::left << std::setw(16) << "time of day" << std::right << std::setw(12) << nativeTime << '\n';
+
+    if (expressionTimestamps != nativeTimestamps)
+    {
+        std::cerr << "The timestamps differ.\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
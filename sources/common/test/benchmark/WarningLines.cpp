@@ -0,0 +1,204 @@
+/// @file common/test/benchmark/WarningLines.cpp
+///
+/// Benchmark of the log lines raising warnings.
+///
+/// @par Full Description
+/// The benchmark compares the former exception based reporting of too small
+/// vectors with the warnings reported through the creation sink for logs
+/// with 0%, 10% and 50% of the lines raising warnings.
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <random>
+#include <regex>
+#include <string>
+#include <vector>
+
+#include "ISignalCreator.h"
+#include "ISignal.h"
+#include "Logger.h"
+#include "SourceRegistry.h"
+#include "VcdException.h"
+
+/// The default number of log lines.
+static const size_t DEFAULT_LINES = 200000;
+
+/// The number of runs of which the best one is reported.
+static const size_t RUNS = 3;
+
+/// Returns the best time of the parsing function in milliseconds.
+///
+/// @param rLines The log lines.
+/// @param rParse The parsing function returning the number of created signals.
+/// @param rCreated The number of created signals.
+static double Measure(const std::vector<std::string> &rLines,
+                      const std::function<size_t(const std::vector<std::string> &)> &rParse,
+                      size_t &rCreated)
+{
+    double best = 0;
+
+    for (size_t run = 0; run < RUNS; ++run)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        rCreated = rParse(rLines);
+        const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+
+        if ((0 == run) || (elapsed.count() < best))
+        {
+            best = elapsed.count();
+        }
+    }
+
+    return best;
+}
+
+/// Runs the benchmark of the log.
+///
+/// @param rName The name of the log.
+/// @param rLines The log lines.
+/// @param sourceHandle The log source handle.
+/// @return False if the number of created signals differs.
+static bool Run(const std::string &rName,
+                const std::vector<std::string> &rLines,
+                SIGNAL::SourceRegistry::HandleT sourceHandle)
+{
+    const PARSER::ISignalCreator creator;
+
+    size_t throwingCreated = 0;
+    const double throwingTime = Measure(rLines,
+                                        [&creator, sourceHandle](const std::vector<std::string> &rParsed)
+    {
+        // The former path in which the signal constructor throws.
+        const std::regex signalRegEx("^" + creator.GetRegEx() + "\r?$");
+        size_t created = 0;
+
+        for (const std::string &rLine : rParsed)
+        {
+            std::smatch result;
+            if (std::regex_search(rLine, result, signalRegEx))
+            {
+                try
+                {
+                    delete new SIGNAL::ISignal(result[2].str(),
+                                               std::stoull(result[4].str()),
+                                               std::stoull(result[1].str()),
+                                               std::stoull(result[3].str()),
+                                               sourceHandle);
+                    ++created;
+                }
+                catch (const EXCEPTION::TooSmallVector &smallVector)
+                {
+                    LOGGER::Logger::GetInstance().LogWarning(EXCEPTION::Warning::INSUFFICIENT_VECTOR_SIZE,
+                                                             rLine + smallVector.what());
+                }
+            }
+        }
+        return created;
+    },
+    throwingCreated);
+
+    size_t statusCreated = 0;
+    const double statusTime = Measure(rLines,
+                                      [&creator, sourceHandle](const std::vector<std::string> &rParsed)
+    {
+        size_t created = 0;
+        std::vector<SIGNAL::Signal *> vpSignals;
+        PARSER::CreationSink sink(vpSignals);
+
+        for (size_t line = 0; line < rParsed.size(); ++line)
+        {
+            creator.Create(rParsed[line], line, sourceHandle, sink);
+
+            for (const PARSER::CreationSink::Warning &rWarning : sink.GetWarnings())
+            {
+                LOGGER::Logger::GetInstance().LogWarning(rWarning.m_Id,
+                                                         rParsed[line] + rWarning.m_Message);
+            }
+            sink.ClearWarnings();
+
+            for (SIGNAL::Signal *pSignal : vpSignals)
+            {
+                delete pSignal;
+                ++created;
+            }
+            vpSignals.clear();
+        }
+        return created;
+    },
+    statusCreated);
+
+    std::cout << std::left << std::setw(16) << rName << std::right << std::fixed << std::setprecision(1)
+              << std::setw(12) << throwingTime
+              << std::setw(12) << statusTime << '\n';
+
+    return (throwingCreated == statusCreated);
+}
+
+/// The benchmark entry point.
+int main(int argc, const char *argv[])
+{
+    const size_t count = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : DEFAULT_LINES;
+    const SIGNAL::SourceRegistry::HandleT sourceHandle = SIGNAL::SourceRegistry::GetInstance().Register("benchmark");
+
+    // The warnings are formatted but discarded by the stream without a buffer.
+    std::ostream warnings(nullptr);
+    LOGGER::Logger::GetInstance().SetOutput(&warnings);
+
+    std::cout << "Parsing " << count << " lines, best of " << RUNS << " runs [ms]\n"
+              << std::left << std::setw(16) << "Warning lines" << std::right
+              << std::setw(12) << "throwing"
+              << std::setw(12) << "status" << '\n';
+
+    bool consistent = true;
+
+    for (const size_t percent : {0, 10, 50})
+    {
+        std::mt19937_64 generator(2026);
+        std::vector<std::string> lines(count);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            const uint64_t random = generator();
+            const bool warning = ((random % 100) < percent);
+
+            // The 8-bit vector cannot hold the values from 256 onwards.
+            lines[i] = '#' + std::to_string(i) + " top.module.reg" + std::to_string(random % 16) + ' ' +
+                       std::to_string(warning ? 256 + (random >> 8) % 65280 : (random >> 8) % 256) + " 8";
+        }
+
+        consistent &= Run(std::to_string(percent) + "%", lines, sourceHandle);
+    }
+
+    if (!consistent)
+    {
+        std::cerr << "The numbers of created signals differ.\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,71 @@
+/// @file common/test/unitTest/CsvScanner.cpp
+///
+/// Unit test for CsvScanner class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+
+#include <string>
+
+#include "catch.hpp"
+
+#include "CsvScanner.h"
+
+/// Unit test for CsvScanner class.
+TEST_CASE("CsvScanner")
+{
+    const PARSER::CsvScanner scanner(';');
+
+    SECTION("Structural characters")
+    {
+        REQUIRE(scanner.GetDelimiter() == ';');
+        REQUIRE(scanner.Find("abc;def", 7) == 3);
+        REQUIRE(scanner.Find("ab\"c", 4) == 2);
+        REQUIRE(scanner.Find("a\r\n", 3) == 1);
+        REQUIRE(scanner.Find("\nabc", 4) == 0);
+        REQUIRE(scanner.Find("a,b,c", 5) == 5);
+        REQUIRE(scanner.Find("", 0) == 0);
+    }
+
+    SECTION("Block boundaries")
+    {
+        // Every position within and across the scanned blocks.
+        for (size_t position = 0; position < 70; ++position)
+        {
+            std::string text(70, 'x');
+            text[position] = ';';
+            REQUIRE(scanner.Find(text.data(), text.size()) == position);
+            REQUIRE(scanner.Find(text.data(), position) == position);
+        }
+    }
+
+    SECTION("Data size")
+    {
+        // The characters beyond the size are not scanned.
+        const std::string text = std::string(40, 'x') + ";";
+        for (size_t size = 0; size <= 40; ++size)
+        {
+            REQUIRE(scanner.Find(text.data(), size) == size);
+        }
+    }
+}
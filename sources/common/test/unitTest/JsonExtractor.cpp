@@ -0,0 +1,142 @@
+/// @file common/test/unitTest/JsonExtractor.cpp
+///
+/// Unit test for JsonExtractor class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <string>
+
+#include "catch.hpp"
+
+#include "JsonExtractor.h"
+#include "VcdException.h"
+
+/// Unit test for JsonExtractor class.
+TEST_CASE("JsonExtractor")
+{
+    PARSER::JsonExtractor extractor;
+
+    REQUIRE(extractor.AddPath("ts") == 1);
+    REQUIRE(extractor.AddPath("signal.name") == 2);
+    REQUIRE(extractor.AddPath("signal.data.1") == 3);
+    REQUIRE(extractor.AddPath("ts") == 1);
+    REQUIRE(extractor.GetPathCount() == 3);
+
+    const std::vector<std::string_view> &rValues = extractor.GetValues();
+
+    SECTION("Values")
+    {
+        const std::string line = R"({"ts": 125, "signal": {"name": "top.a", "data": [1, -2.5e3, 3]}})";
+
+        REQUIRE(extractor.Extract(line));
+        REQUIRE(rValues[0] == line);
+        REQUIRE(rValues[1] == "125");
+        REQUIRE(rValues[2] == "top.a");
+        REQUIRE(rValues[3] == "-2.5e3");
+
+        // The numeric keys match the object keys too.
+        REQUIRE(extractor.Extract(R"({"signal": {"data": {"1": null}, "name": "top.b"}, "ts": 5})"));
+        REQUIRE(rValues[1] == "5");
+        REQUIRE(rValues[2] == "top.b");
+        REQUIRE(rValues[3] == "null");
+    }
+
+    SECTION("Skipped values")
+    {
+        const std::string line = R"({"x": {"ts": 1, "s": "}]\""}, "list": [[{}], "[", {"a": [1, {"b": 2}]}], )"
+                                 R"("signal": {"data": [{"ts": 0}, true], "name": "n"}, "ts": 7})";
+
+        REQUIRE(extractor.Extract(line));
+        REQUIRE(rValues[1] == "7");
+        REQUIRE(rValues[2] == "n");
+        REQUIRE(rValues[3] == "true");
+    }
+
+    SECTION("Containers")
+    {
+        REQUIRE(extractor.Extract(R"({"ts": 1, "signal": {"name": {"a": [1]}, "data": [0, [2, 3]]}})"));
+        REQUIRE(rValues[2] == R"({"a": [1]})");
+        REQUIRE(rValues[3] == "[2, 3]");
+    }
+
+    SECTION("Escape sequences")
+    {
+        REQUIRE(extractor.Extract(R"({"ts": "1", "signal": {"name": "a\"b\\c\/d\t\u00e9\ud83d\ude00", "data": [0, ""]}})"));
+        REQUIRE(rValues[1] == "1");
+        REQUIRE(rValues[2] == "a\"b\\c/d\t\xC3\xA9\xF0\x9F\x98\x80");
+        REQUIRE(rValues[3] == "");
+
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": 1, "signal": {"name": "\x", "data": [0, 1]}})"));
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": 1, "signal": {"name": "\u12", "data": [0, 1]}})"));
+    }
+
+    SECTION("Duplicated keys")
+    {
+        REQUIRE(extractor.Extract(R"({"ts": 1, "ts": 2, "signal": {"name": "a", "data": [0, 1]}})"));
+        REQUIRE(rValues[1] == "1");
+    }
+
+    SECTION("Missing values")
+    {
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": 1, "signal": {"name": "a", "data": [0]}})"));
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": 1, "signal": "a"})"));
+        REQUIRE_FALSE(extractor.Extract(R"([1, 2])"));
+        REQUIRE_FALSE(extractor.Extract(""));
+    }
+
+    SECTION("Malformed text")
+    {
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": 1, "signal": {"name": "a", "data": [0 1]}})"));
+        REQUIRE_FALSE(extractor.Extract(R"({"ts" 1, "signal": {"name": "a", "data": [0, 1]}})"));
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": 1, "signal": {"name": "a, "data": [0, 1]}})"));
+        REQUIRE_FALSE(extractor.Extract(R"({"x": [1, 2, "ts": 1, "signal": {"name": "a", "data": [0, 1]}})"));
+        REQUIRE_FALSE(extractor.Extract(R"({"ts": , "signal": {"name": "a", "data": [0, 1]}})"));
+    }
+
+    SECTION("Nesting depth")
+    {
+        PARSER::JsonExtractor deepExtractor;
+        std::string path = "a";
+        for (size_t level = 0; level < 100; ++level)
+        {
+            path += ".a";
+        }
+        deepExtractor.AddPath(path);
+
+        std::string line;
+        for (size_t level = 0; level <= 101; ++level)
+        {
+            line += "{\"a\": ";
+        }
+        line += "1" + std::string(102, '}');
+
+        REQUIRE_FALSE(deepExtractor.Extract(line));
+    }
+
+    SECTION("Invalid paths")
+    {
+        REQUIRE_THROWS_AS(extractor.AddPath(""), EXCEPTION::VcdException);
+        REQUIRE_THROWS_AS(extractor.AddPath("a..b"), EXCEPTION::VcdException);
+        REQUIRE_THROWS_AS(extractor.AddPath("a."), EXCEPTION::VcdException);
+    }
+}
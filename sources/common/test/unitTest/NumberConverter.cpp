@@ -0,0 +1,186 @@
+/// @file common/test/unitTest/NumberConverter.cpp
+///
+/// Unit test for NumberConverter class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cerrno>
+#include <charconv>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "catch.hpp"
+
+#include "NumberConverter.h"
+
+using UTILS::ConversionStatus;
+using UTILS::NumberConverter;
+
+/// Unit test for NumberConverter class.
+TEST_CASE("NumberConverter")
+{
+    uint64_t value = 0;
+    double floatValue = 0.0;
+
+    SECTION("Decimal")
+    {
+        REQUIRE(NumberConverter::ConvertDecimal("0", value) == ConversionStatus::OK);
+        REQUIRE(value == 0);
+        REQUIRE(NumberConverter::ConvertDecimal("12345678", value) == ConversionStatus::OK);
+        REQUIRE(value == 12345678);
+        REQUIRE(NumberConverter::ConvertDecimal("123456789012", value) == ConversionStatus::OK);
+        REQUIRE(value == 123456789012);
+        REQUIRE(NumberConverter::ConvertDecimal("  +42abc", value) == ConversionStatus::OK);
+        REQUIRE(value == 42);
+        REQUIRE(NumberConverter::ConvertDecimal("9223372036854775808", value) == ConversionStatus::OK);
+        REQUIRE(value == 9223372036854775808U);
+        REQUIRE(NumberConverter::ConvertDecimal("18446744073709551615", value) == ConversionStatus::OK);
+        REQUIRE(value == 18446744073709551615U);
+        REQUIRE(NumberConverter::ConvertDecimal("0000000000000000000000000018446744073709551615", value) == ConversionStatus::OK);
+        REQUIRE(value == 18446744073709551615U);
+        REQUIRE(NumberConverter::ConvertDecimal("-1", value) == ConversionStatus::OK);
+        REQUIRE(value == 18446744073709551615U);
+        REQUIRE(NumberConverter::ConvertDecimal("18446744073709551616", value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(NumberConverter::ConvertDecimal("123456789012345678901234", value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(NumberConverter::ConvertDecimal("", value) == ConversionStatus::INVALID);
+        REQUIRE(NumberConverter::ConvertDecimal("abc", value) == ConversionStatus::INVALID);
+        REQUIRE(NumberConverter::ConvertDecimal("--1", value) == ConversionStatus::INVALID);
+    }
+
+    SECTION("Hex")
+    {
+        REQUIRE(NumberConverter::ConvertHex("1f", value) == ConversionStatus::OK);
+        REQUIRE(value == 0x1F);
+        REQUIRE(NumberConverter::ConvertHex("DeadBeef", value) == ConversionStatus::OK);
+        REQUIRE(value == 0xDEADBEEF);
+        REQUIRE(NumberConverter::ConvertHex("0123456789abcdef", value) == ConversionStatus::OK);
+        REQUIRE(value == 0x0123456789ABCDEF);
+        REQUIRE(NumberConverter::ConvertHex("0xFFFFFFFFFFFFFFFF", value) == ConversionStatus::OK);
+        REQUIRE(value == 0xFFFFFFFFFFFFFFFF);
+        REQUIRE(NumberConverter::ConvertHex("00000000000000001", value) == ConversionStatus::OK);
+        REQUIRE(value == 1);
+        REQUIRE(NumberConverter::ConvertHex("0xg", value) == ConversionStatus::OK);
+        REQUIRE(value == 0);
+        REQUIRE(NumberConverter::ConvertHex("12345678:9", value) == ConversionStatus::OK);
+        REQUIRE(value == 0x12345678);
+        REQUIRE(NumberConverter::ConvertHex("1ffffffffffffffff", value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(NumberConverter::ConvertHex("0x", value) == ConversionStatus::OK);
+        REQUIRE(value == 0);
+        REQUIRE(NumberConverter::ConvertHex("x1", value) == ConversionStatus::INVALID);
+        REQUIRE(NumberConverter::ConvertHex("", value) == ConversionStatus::INVALID);
+    }
+
+    SECTION("Float")
+    {
+        REQUIRE(NumberConverter::ConvertFloat("1.25", floatValue) == ConversionStatus::OK);
+        REQUIRE(floatValue == 1.25);
+        REQUIRE(NumberConverter::ConvertFloat("  -2.5e3x", floatValue) == ConversionStatus::OK);
+        REQUIRE(floatValue == -2500.0);
+        REQUIRE(NumberConverter::ConvertFloat("+7", floatValue) == ConversionStatus::OK);
+        REQUIRE(floatValue == 7.0);
+        REQUIRE(NumberConverter::ConvertFloat("0x1.8p1", floatValue) == ConversionStatus::OK);
+        REQUIRE(floatValue == 3.0);
+        REQUIRE(NumberConverter::ConvertFloat("1e400", floatValue) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(NumberConverter::ConvertFloat("x", floatValue) == ConversionStatus::INVALID);
+        REQUIRE(NumberConverter::ConvertFloat("+-1", floatValue) == ConversionStatus::INVALID);
+        REQUIRE(NumberConverter::ConvertFloat("", floatValue) == ConversionStatus::INVALID);
+    }
+
+    SECTION("End of the number")
+    {
+        size_t end = 0;
+
+        REQUIRE(NumberConverter::ConvertDecimal(" 5abc", value, end) == ConversionStatus::OK);
+        REQUIRE(end == 2);
+        REQUIRE(NumberConverter::ConvertHex("0x1Fg", value, end) == ConversionStatus::OK);
+        REQUIRE(end == 4);
+        REQUIRE(NumberConverter::ConvertHex("123456789abcdef0", value, end) == ConversionStatus::OK);
+        REQUIRE(end == 16);
+        REQUIRE(NumberConverter::ConvertFloat("2.0xyz", floatValue, end) == ConversionStatus::OK);
+        REQUIRE(end == 3);
+        REQUIRE(NumberConverter::ConvertFloat("-1.5e", floatValue, end) == ConversionStatus::OK);
+        REQUIRE(end == 4);
+        REQUIRE(NumberConverter::ConvertFloat("0x1p3", floatValue, end) == ConversionStatus::OK);
+        REQUIRE(end == 5);
+    }
+
+    SECTION("Printing floats")
+    {
+        // The printed values convert back exactly.
+        for (double printed : {1.25, 0.1, -2500.0, 1e300, 4.9e-324})
+        {
+            REQUIRE(std::strtod(NumberConverter::PrintFloat(printed).c_str(), nullptr) == printed);
+        }
+
+        for (float printed : {0.1f, -3.5f, 3.4028235e38f, 1e-45f})
+        {
+            REQUIRE(std::strtof(NumberConverter::PrintFloat(printed, true).c_str(), nullptr) == printed);
+        }
+
+#if defined(__cpp_lib_to_chars)
+        REQUIRE(NumberConverter::PrintFloat(0.1) == "0.1");
+        REQUIRE(NumberConverter::PrintFloat(0.1f, true) == "0.1");
+        REQUIRE(NumberConverter::PrintFloat(-2500.0) == "-2500");
+#endif
+    }
+
+    SECTION("Conformance with strtoull")
+    {
+        const std::string characters("0123456789abcdefABCDEFxX+- g");
+        std::mt19937 generator(2026);
+        std::uniform_int_distribution<size_t> lengths(0, 24);
+        std::uniform_int_distribution<size_t> indexes(0, characters.size() - 1);
+        std::uniform_int_distribution<size_t> digitIndexes(0, 9);
+
+        for (size_t i = 0; i < 20000; ++i)
+        {
+            std::string text;
+            const size_t length = lengths(generator);
+            for (size_t j = 0; j < length; ++j)
+            {
+                // Mostly decimal digits, so that the long runs are covered.
+                text += ((j % 5) == 4) ? characters[indexes(generator)] : characters[digitIndexes(generator)];
+            }
+
+            for (int base : {10, 16})
+            {
+                char *pEnd = nullptr;
+                errno = 0;
+                const uint64_t expected = std::strtoull(text.c_str(), &pEnd, base);
+                const ConversionStatus expectedStatus = (pEnd == text.c_str()) ? ConversionStatus::INVALID :
+                                                        ((ERANGE == errno) ? ConversionStatus::OUT_OF_RANGE : ConversionStatus::OK);
+
+                const ConversionStatus status = (10 == base) ? NumberConverter::ConvertDecimal(text, value) :
+                                                NumberConverter::ConvertHex(text, value);
+
+                INFO(text << " base " << base);
+                REQUIRE(status == expectedStatus);
+                if (ConversionStatus::OK == status)
+                {
+                    REQUIRE(value == expected);
+                }
+            }
+        }
+    }
+}
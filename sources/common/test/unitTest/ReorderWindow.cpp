@@ -0,0 +1,109 @@
+/// @file common/test/unitTest/ReorderWindow.cpp
+///
+/// Unit test for ReorderWindow class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <vector>
+
+#include "catch.hpp"
+
+#include "ReorderWindow.h"
+#include "VcdException.h"
+#include "stub/DummySignal.h"
+
+/// The consumer collecting the timestamps of the signals.
+class CollectingConsumer : public SIGNAL::SignalConsumer
+{
+    public:
+
+        /// @copydoc SIGNAL::SignalConsumer::Consume()
+        virtual void Consume(SIGNAL::Signal *pSignal)
+        {
+            m_Timestamps.push_back(pSignal->GetTimestamp().GetValue());
+            delete pSignal;
+        }
+
+        /// @copydoc SIGNAL::SignalConsumer::End()
+        virtual void End()
+        {
+            m_Ended = true;
+        }
+
+        /// The timestamps of the consumed signals.
+        std::vector<uint64_t> m_Timestamps;
+
+        /// The end of stream flag.
+        bool m_Ended = false;
+};
+
+/// Unit test for ReorderWindow class.
+TEST_CASE("ReorderWindow")
+{
+    CollectingConsumer consumer;
+
+    SECTION("Time window")
+    {
+        TRACER::ReorderWindow window(consumer, TRACER::ReorderWindow::WindowT::TIME, 3);
+
+        for (uint64_t timestamp : {2, 1, 5, 3, 9})
+        {
+            window.Consume(new DummySignal("Top.a", timestamp));
+        }
+
+        REQUIRE(consumer.m_Timestamps == std::vector<uint64_t>({1, 2, 3, 5}));
+
+        window.End();
+
+        REQUIRE(consumer.m_Timestamps == std::vector<uint64_t>({1, 2, 3, 5, 9}));
+        REQUIRE(consumer.m_Ended);
+    }
+
+    SECTION("Events window")
+    {
+        TRACER::ReorderWindow window(consumer, TRACER::ReorderWindow::WindowT::EVENTS, 2);
+
+        for (uint64_t timestamp : {3, 1, 2, 6, 4})
+        {
+            window.Consume(new DummySignal("Top.a", timestamp));
+        }
+
+        REQUIRE(consumer.m_Timestamps == std::vector<uint64_t>({1, 2, 3}));
+
+        window.End();
+
+        REQUIRE(consumer.m_Timestamps == std::vector<uint64_t>({1, 2, 3, 4, 6}));
+    }
+
+    SECTION("Signal beyond the window")
+    {
+        TRACER::ReorderWindow window(consumer, TRACER::ReorderWindow::WindowT::EVENTS, 1);
+
+        window.Consume(new DummySignal("Top.a", 5));
+        window.Consume(new DummySignal("Top.a", 6));
+
+        DummySignal late("Top.a", 4);
+        REQUIRE_THROWS_AS(window.Consume(&late), EXCEPTION::VcdException);
+        REQUIRE(consumer.m_Timestamps == std::vector<uint64_t>({5}));
+    }
+}
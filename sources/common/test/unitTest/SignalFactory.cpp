@@ -0,0 +1,398 @@
+/// @file common/test/unitTest/SignalFactory.cpp
+///
+/// Unit test for SignalFactory class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "SignalFactory.h"
+#include "XmlISignalCreator.h"
+#include "XmlFSignalCreator.h"
+#include "XmlGroupSignalCreator.h"
+#include "XmlFieldsSignalCreator.h"
+#include "XmlJsonSignalCreator.h"
+#include "XmlEventSignalCreator.h"
+#include "ISignal.h"
+#include "FSignal.h"
+#include "EventSignal.h"
+#include "Logger.h"
+
+/// The factory of the XML vector and real signals.
+class TestSignalFactory : public PARSER::SignalFactory
+{
+    public:
+        /// The test factory constructor.
+        ///
+        /// @param exclusive True if the creators are declared exclusive.
+        TestSignalFactory(bool exclusive = false) :
+            PARSER::SignalFactory(exclusive)
+        {
+            m_vpSignalCreators.push_back(std::make_unique<PARSER::XmlISignalCreator>("^V ([0-9]+) ([a-z0-9.]+) ([0-9a-f]+) ([0-9]+)$",
+                                                                                     "dec(1) * 10",
+                                                                                     "txt(2) + \".v\"",
+                                                                                     "hex(3)",
+                                                                                     "dec(4)"));
+            m_vpSignalCreators.push_back(std::make_unique<PARSER::XmlFSignalCreator>("^F ([0-9]+) ([a-z.]+) ([0-9.]+)$",
+                                                                                     "dec(1) * 10",
+                                                                                     "txt(2) + \".f\"",
+                                                                                     "flt(3)"));
+
+            std::unique_ptr<PARSER::XmlGroupSignalCreator> pGroup =
+                std::make_unique<PARSER::XmlGroupSignalCreator>("^G ([0-9]+) ([a-z.]+) ([0-9]+) ([0-9]+)$");
+            pGroup->AddVector("dec(1)", "txt(2) + \".x\"", "dec(3)", "8");
+            pGroup->AddVector("dec(1) + 1", "txt(2) + \".y\"", "dec(4)", "8");
+            pGroup->AddEvent("dec(1)", "txt(2) + \".e\"");
+            m_vpSignalCreators.push_back(std::move(pGroup));
+
+            std::unique_ptr<PARSER::XmlFieldsSignalCreator> pFields = std::make_unique<PARSER::XmlFieldsSignalCreator>(';', 3);
+            pFields->AddGuard(1, "P");
+            pFields->AddVector("dec(2)", "\"top.p\"", "hex(3)", "16");
+            m_vpSignalCreators.push_back(std::move(pFields));
+
+            std::unique_ptr<PARSER::XmlJsonSignalCreator> pJson = std::make_unique<PARSER::XmlJsonSignalCreator>();
+            pJson->AddGuard(pJson->AddPath("kind"), "J");
+            pJson->AddPath("ts");
+            pJson->AddPath("signal.id");
+            pJson->AddPath("signal.value");
+            pJson->AddVector("dec(2)", "\"top.\" + txt(3)", "hex(4)", "16");
+            m_vpSignalCreators.push_back(std::move(pJson));
+
+            // The timestamps of the native formats are given in microseconds.
+            std::unique_ptr<PARSER::XmlSignalCreator> pTime =
+                std::make_unique<PARSER::XmlEventSignalCreator>("^T ([0-9:.]+) ([a-z.]+)$", "1", "txt(2)");
+            pTime->SetTimestampFormat(PARSER::TimestampFormat{PARSER::TimestampFormat::Kind::TIME_OF_DAY, 1, 2, 2});
+            m_vpSignalCreators.push_back(std::move(pTime));
+
+            std::unique_ptr<PARSER::XmlGroupSignalCreator> pDecimal =
+                std::make_unique<PARSER::XmlGroupSignalCreator>("^D ([0-9.]+ ?[a-z]*) ([a-z.]+)$");
+            pDecimal->AddEvent("1", "txt(2)", PARSER::TimestampFormat{PARSER::TimestampFormat::Kind::DECIMAL, 1, 1, 2});
+            m_vpSignalCreators.push_back(std::move(pDecimal));
+
+            // The event lines are matched by two creators.
+            m_vpSignalCreators.push_back(std::make_unique<PARSER::XmlEventSignalCreator>("^E ([0-9]+) ([a-z.]+)$",
+                                                                                         "dec(1)",
+                                                                                         "txt(2) + \".a\""));
+            m_vpSignalCreators.push_back(std::make_unique<PARSER::XmlEventSignalCreator>("^E ([0-9]+) ([a-z.]+)$",
+                                                                                         "dec(1)",
+                                                                                         "txt(2) + \".b\""));
+        }
+};
+
+/// Returns the log line of the vector signal.
+static std::string GetVectorLine(uint64_t timestamp, const std::string &rName, uint64_t value, size_t size)
+{
+    char hexValue[20];
+    std::snprintf(hexValue, sizeof(hexValue), "%llx", static_cast<unsigned long long>(value));
+    return "V " + std::to_string(timestamp) + ' ' + rName + ' ' + hexValue + ' ' + std::to_string(size);
+}
+
+/// Checks the created vector signal.
+static bool IsVector(const SIGNAL::Signal *pSignal, uint64_t timestamp, const std::string &rName, uint64_t value)
+{
+    const SIGNAL::ISignal *pVector = dynamic_cast<const SIGNAL::ISignal *>(pSignal);
+
+    return (nullptr != pVector) &&
+           (pVector->GetTimestamp() == TIME::Timestamp(timestamp * 10)) &&
+           (pVector->GetName() == rName + ".v") &&
+           (pVector->GetValue() == value);
+}
+
+/// Unit test for SignalFactory class.
+TEST_CASE("SignalFactory")
+{
+    const SIGNAL::SourceRegistry::HandleT handle = SIGNAL::SourceRegistry::GetInstance().Register("utSignalFactory");
+    const TestSignalFactory factory;
+
+    SECTION("SignalFactory::Create")
+    {
+        std::string vectorLine = GetVectorLine(5, "top.a", 0xab, 8);
+        std::string realLine = "F 7 top.b 1.5";
+        std::string invalidLine = "X 7 top.b 1.5";
+
+        std::vector<SIGNAL::Signal *> vpSignals;
+
+        REQUIRE(1 == factory.Create(vectorLine, 1, handle, vpSignals));
+        REQUIRE(1 == vpSignals.size());
+        REQUIRE(IsVector(vpSignals[0], 5, "top.a", 0xab));
+
+        // The signals are appended to the buffer.
+        REQUIRE(1 == factory.Create(realLine, 2, handle, vpSignals));
+        REQUIRE(2 == vpSignals.size());
+        const SIGNAL::FSignal *pReal = dynamic_cast<const SIGNAL::FSignal *>(vpSignals[1]);
+        REQUIRE(nullptr != pReal);
+        REQUIRE(pReal->GetName() == "top.b.f");
+        REQUIRE(pReal->GetTimestamp() == TIME::Timestamp(70));
+
+        REQUIRE(0 == factory.Create(invalidLine, 3, handle, vpSignals));
+        REQUIRE(2 == vpSignals.size());
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+    }
+
+    SECTION("Signal group")
+    {
+        std::string groupLine = "G 4 top.g 1 300";
+        std::vector<SIGNAL::Signal *> vpSignals;
+
+        std::ostream nullOutput(nullptr);
+        LOGGER::Logger::GetInstance().SetOutput(&nullOutput);
+
+        // The second vector is too small, the other signals are created.
+        REQUIRE(2 == factory.Create(groupLine, 1, handle, vpSignals));
+        REQUIRE(2 == vpSignals.size());
+        const SIGNAL::ISignal *pVector = dynamic_cast<const SIGNAL::ISignal *>(vpSignals[0]);
+        REQUIRE(nullptr != pVector);
+        REQUIRE(pVector->GetName() == "top.g.x");
+        REQUIRE(pVector->GetValue() == 1);
+        REQUIRE(nullptr != dynamic_cast<const SIGNAL::EventSignal *>(vpSignals[1]));
+        REQUIRE(vpSignals[1]->GetName() == "top.g.e");
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+        vpSignals.clear();
+
+        groupLine = "G 4 top.g 1 2";
+        REQUIRE(3 == factory.Create(groupLine, 2, handle, vpSignals));
+        REQUIRE(vpSignals[1]->GetName() == "top.g.y");
+        REQUIRE(vpSignals[1]->GetTimestamp() == TIME::Timestamp(5));
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+
+        LOGGER::Logger::GetInstance().SetOutput(&std::cerr);
+    }
+
+    SECTION("Delimiter-separated fields")
+    {
+        std::vector<SIGNAL::Signal *> vpSignals;
+
+        for (const char *pLine : {"P;4;ff", "P;5;1a\r", "P;4", "P;4;ff;1", "Q;4;ff", "P;4;ff;"})
+        {
+            std::string fieldsLine = pLine;
+            factory.Create(fieldsLine, 1, handle, vpSignals);
+        }
+
+        // Only the lines with three fields and the guarded first one match.
+        REQUIRE(2 == vpSignals.size());
+        const SIGNAL::ISignal *pVector = dynamic_cast<const SIGNAL::ISignal *>(vpSignals[1]);
+        REQUIRE(nullptr != pVector);
+        REQUIRE(pVector->GetName() == "top.p");
+        REQUIRE(pVector->GetTimestamp() == TIME::Timestamp(5));
+        REQUIRE(pVector->GetValue() == 0x1a);
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+    }
+
+    SECTION("JSON lines")
+    {
+        std::vector<SIGNAL::Signal *> vpSignals;
+
+        for (const char *pLine : {R"({"kind": "J", "ts": 7, "signal": {"id": "j", "value": "1f"}})",
+                                  R"({"signal": {"value": "2a", "id": "k"}, "ts": 8, "kind": "J"})",
+                                  R"({"kind": "K", "ts": 9, "signal": {"id": "j", "value": "1f"}})",
+                                  R"({"kind": "J", "ts": 9, "signal": {"id": "j"}})",
+                                  R"({"kind": "J", "ts": 9, "signal": {"id": "j", "value": "1f)"})
+        {
+            std::string jsonLine = pLine;
+            factory.Create(jsonLine, 1, handle, vpSignals);
+        }
+
+        // Only the complete lines of the guarded kind match.
+        REQUIRE(2 == vpSignals.size());
+        const SIGNAL::ISignal *pVector = dynamic_cast<const SIGNAL::ISignal *>(vpSignals[1]);
+        REQUIRE(nullptr != pVector);
+        REQUIRE(pVector->GetName() == "top.k");
+        REQUIRE(pVector->GetTimestamp() == TIME::Timestamp(8));
+        REQUIRE(pVector->GetValue() == 0x2a);
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+    }
+
+    SECTION("Native timestamps")
+    {
+        std::vector<SIGNAL::Signal *> vpSignals;
+
+        for (const char *pLine : {"T 12:03:44.123456 top.t", "D 2.5 top.d", "D 3 s top.d"})
+        {
+            std::string timeLine = pLine;
+            REQUIRE(1 == factory.Create(timeLine, 1, handle, vpSignals));
+        }
+
+        REQUIRE(3 == vpSignals.size());
+        REQUIRE(vpSignals[0]->GetTimestamp() == TIME::Timestamp(43424123456U));
+        REQUIRE(vpSignals[1]->GetTimestamp() == TIME::Timestamp(2500));
+        REQUIRE(vpSignals[2]->GetTimestamp() == TIME::Timestamp(3000000));
+
+        // The invalid timestamps raise the warnings and no signal is created.
+        std::ostringstream warnings;
+        LOGGER::Logger::GetInstance().SetOutput(&warnings);
+
+        for (const char *pLine : {"T 25:00:00 top.t", "T 12:03:44. top.t", "D 3 min top.d", "D 18446744073709552 s top.d"})
+        {
+            std::string invalidLine = pLine;
+            REQUIRE(0 == factory.Create(invalidLine, 1, handle, vpSignals));
+        }
+
+        LOGGER::Logger::GetInstance().SetOutput(&std::cerr);
+
+        REQUIRE(3 == vpSignals.size());
+        REQUIRE(warnings.str().find("Cannot convert the time of day: 25:00:00. Dropping the signal.") != std::string::npos);
+        REQUIRE(warnings.str().find("Cannot convert the decimal time: 3 min. Dropping the signal.") != std::string::npos);
+        REQUIRE(warnings.str().find("Out of range timestamp: 18446744073709552 s. Dropping the signal.") != std::string::npos);
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+    }
+
+    SECTION("Too small vector")
+    {
+        std::ostream nullOutput(nullptr);
+        LOGGER::Logger::GetInstance().SetOutput(&nullOutput);
+
+        // The line raises the warning and no signal is created.
+        std::string line = GetVectorLine(5, "top.a", 0x100, 8);
+        std::vector<SIGNAL::Signal *> vpSignals;
+        REQUIRE(0 == factory.Create(line, 1, handle, vpSignals));
+        REQUIRE(vpSignals.empty());
+
+        LOGGER::Logger::GetInstance().SetOutput(&std::cerr);
+    }
+
+    SECTION("Exclusive creators")
+    {
+        const TestSignalFactory exclusiveFactory(true);
+        std::string eventLine = "E 3 top.c";
+        std::vector<SIGNAL::Signal *> vpSignals;
+
+        REQUIRE_FALSE(factory.IsExclusive());
+        REQUIRE(exclusiveFactory.IsExclusive());
+
+        // All the matching creators are used unless they are exclusive.
+        REQUIRE(2 == factory.Create(eventLine, 1, handle, vpSignals));
+        REQUIRE(vpSignals[0]->GetName() == "top.c.a");
+        REQUIRE(vpSignals[1]->GetName() == "top.c.b");
+
+        // The frequent real lines move their creator to the front.
+        for (size_t line = 0; line < 10; ++line)
+        {
+            std::string realLine = "F " + std::to_string(line) + " top.d 0.5";
+            REQUIRE(1 == exclusiveFactory.Create(realLine, line, handle, vpSignals));
+        }
+
+        // Creators with the same number of hits keep their order.
+        REQUIRE(1 == exclusiveFactory.Create(eventLine, 12, handle, vpSignals));
+        REQUIRE(vpSignals.back()->GetName() == "top.c.a");
+
+        std::string vectorLine = GetVectorLine(5, "top.a", 0xab, 8);
+        REQUIRE(1 == exclusiveFactory.Create(vectorLine, 13, handle, vpSignals));
+        REQUIRE(IsVector(vpSignals.back(), 5, "top.a", 0xab));
+
+        std::string invalidLine = "X 7 top.b 1.5";
+        REQUIRE(0 == exclusiveFactory.Create(invalidLine, 14, handle, vpSignals));
+
+        const std::unique_ptr<PARSER::SignalFactory> pClone = exclusiveFactory.Clone();
+        REQUIRE(pClone->IsExclusive());
+        REQUIRE(1 == pClone->Create(eventLine, 15, handle, vpSignals));
+        REQUIRE(vpSignals.back()->GetName() == "top.c.a");
+
+        REQUIRE(15 == vpSignals.size());
+
+        for (SIGNAL::Signal *pSignal : vpSignals)
+        {
+            delete pSignal;
+        }
+    }
+
+    SECTION("SignalFactory::Clone")
+    {
+        const size_t threads = 4;
+        const size_t lines = 2000;
+
+        std::vector<size_t> matched(threads, 0);
+        std::vector<std::thread> workers;
+
+        // Every thread uses its own copy of the factory.
+        for (size_t thread = 0; thread < threads; ++thread)
+        {
+            workers.emplace_back([&factory, &matched, handle, thread, lines]()
+            {
+                const std::unique_ptr<PARSER::SignalFactory> pFactory = factory.Clone();
+                std::vector<SIGNAL::Signal *> vpSignals;
+
+                for (size_t line = 0; line < lines; ++line)
+                {
+                    const uint64_t timestamp = thread * lines + line;
+                    const std::string name = "top.thread" + std::to_string(thread);
+                    const uint64_t value = (timestamp * 2654435761U) & 0xffffffffU;
+                    std::string logLine = GetVectorLine(timestamp, name, value, 32);
+
+                    if ((1 == pFactory->Create(logLine, line, handle, vpSignals)) &&
+                        IsVector(vpSignals[0], timestamp, name, value))
+                    {
+                        ++matched[thread];
+                    }
+                    for (SIGNAL::Signal *pSignal : vpSignals)
+                    {
+                        delete pSignal;
+                    }
+                    vpSignals.clear();
+                }
+            });
+        }
+
+        for (std::thread &rWorker : workers)
+        {
+            rWorker.join();
+        }
+
+        for (size_t thread = 0; thread < threads; ++thread)
+        {
+            REQUIRE(lines == matched[thread]);
+        }
+    }
+}
@@ -0,0 +1,139 @@
+/// @file common/test/unitTest/SignalRuns.cpp
+///
+/// Unit test for SignalRuns class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "catch.hpp"
+
+#include "SignalRuns.h"
+#include "stub/DummySignal.h"
+
+/// The consumer collecting the printed signals.
+class PrintingConsumer : public SIGNAL::SignalConsumer
+{
+    public:
+
+        /// @copydoc SIGNAL::SignalConsumer::Consume()
+        virtual void Consume(SIGNAL::Signal *pSignal)
+        {
+            m_Prints.push_back(std::to_string(pSignal->GetTimestamp().GetValue()) + " " +
+                               pSignal->Print() + " " +
+                               std::to_string(pSignal->GetId()));
+            delete pSignal;
+        }
+
+        /// The printed signals.
+        std::vector<std::string> m_Prints;
+};
+
+/// Unit test for SignalRuns class.
+TEST_CASE("SignalRuns")
+{
+    DummySignal prototypeA("Top.a", 0);
+    prototypeA.SetId(0);
+    DummySignal prototypeB("Top.b", 0);
+    prototypeB.SetId(1);
+
+    const SIGNAL::SignalRuns::PrototypesT prototypes{&prototypeA, &prototypeB};
+
+    // Creates the signal of the given prototype.
+    auto create = [](const DummySignal &rPrototype, uint64_t timestamp, const std::string &rValue)
+    {
+        DummySignal *pSignal = new DummySignal(rPrototype.GetName(), timestamp, rValue);
+        pSignal->SetId(rPrototype.GetId());
+        return pSignal;
+    };
+
+    SIGNAL::SignalCollectionT first{create(prototypeA, 1, "1"),
+                                    create(prototypeB, 4, "2")};
+    SIGNAL::SignalCollectionT second{create(prototypeB, 2, "3"),
+                                     create(prototypeA, 4, "4")};
+    SIGNAL::SignalCollectionT memory{create(prototypeA, 3, "5"),
+                                     create(prototypeB, 4, "6")};
+
+    SIGNAL::SignalRuns runs;
+    PrintingConsumer consumer;
+
+    SECTION("Merging runs")
+    {
+        runs.Spill(first);
+        runs.Spill(second);
+
+        REQUIRE(runs.GetCount() == 2);
+
+        runs.Merge(prototypes, memory, consumer);
+
+        REQUIRE(consumer.m_Prints == std::vector<std::string>({"1 PRINT 1 Top.a 0",
+                                                               "2 PRINT 3 Top.b 1",
+                                                               "3 PRINT 5 Top.a 0",
+                                                               "4 PRINT 2 Top.b 1",
+                                                               "4 PRINT 4 Top.a 0",
+                                                               "4 PRINT 6 Top.b 1"}));
+    }
+
+    SECTION("No runs")
+    {
+        runs.Merge(prototypes, memory, consumer);
+
+        REQUIRE(consumer.m_Prints == std::vector<std::string>({"3 PRINT 5 Top.a 0",
+                                                               "4 PRINT 6 Top.b 1"}));
+    }
+
+    SECTION("Private directory")
+    {
+        std::string directory;
+
+        REQUIRE(runs.GetDirectory().empty());
+
+        {
+            SIGNAL::SignalRuns otherRuns;
+            otherRuns.Spill(first);
+            runs.Spill(second);
+
+            // Every instance writes the runs into its own new directory.
+            directory = otherRuns.GetDirectory();
+            REQUIRE(std::filesystem::is_directory(directory));
+            REQUIRE_FALSE(std::filesystem::is_symlink(directory));
+            REQUIRE(directory != runs.GetDirectory());
+#if !defined(_WIN32)
+            REQUIRE((std::filesystem::status(directory).permissions() & std::filesystem::perms::all) ==
+                    std::filesystem::perms::owner_all);
+#endif
+        }
+
+        REQUIRE_FALSE(std::filesystem::exists(directory));
+    }
+
+    for (auto signals : {&first, &second, &memory})
+    {
+        for (const SIGNAL::Signal *pSignal : *signals)
+        {
+            delete pSignal;
+        }
+    }
+}
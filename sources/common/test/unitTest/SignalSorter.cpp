@@ -0,0 +1,141 @@
+/// @file common/test/unitTest/SignalSorter.cpp
+///
+/// Unit test for SignalSorter class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <random>
+
+#include "catch.hpp"
+
+#include "SignalSorter.h"
+#include "stub/DummySignal.h"
+
+/// Unit test for SignalSorter class.
+TEST_CASE("SignalSorter")
+{
+    const SIGNAL::SignalSorter sorter(1);
+
+    std::deque<DummySignal> signals;
+    SIGNAL::SignalCollectionT collection;
+
+    // Adds the signal of the given timestamp to the collection.
+    auto add = [&](uint64_t timestamp)
+    {
+        signals.emplace_back("Top.s", timestamp, std::to_string(signals.size()));
+        collection.push_back(&signals.back());
+    };
+
+    SECTION("Empty collection")
+    {
+        sorter.Sort(collection);
+
+        REQUIRE(collection.empty());
+    }
+
+    SECTION("Equal timestamps")
+    {
+        add(5);
+        add(5);
+        add(5);
+
+        const SIGNAL::SignalCollectionT expected(collection);
+
+        sorter.Sort(collection);
+
+        REQUIRE(collection == expected);
+    }
+
+    SECTION("Wide timestamps")
+    {
+        add(UINT64_MAX);
+        add(1ULL << 56);
+        add(0x100);
+        add(1ULL << 56);
+        add(0);
+
+        sorter.Sort(collection);
+
+        REQUIRE(collection[0]->GetTimestamp() == TIME::Timestamp(0));
+        REQUIRE(collection[1]->GetTimestamp() == TIME::Timestamp(0x100));
+        REQUIRE(collection[2]->Print() == "PRINT 1 Top.s");
+        REQUIRE(collection[3]->Print() == "PRINT 3 Top.s");
+        REQUIRE(collection[4]->GetTimestamp() == TIME::Timestamp(UINT64_MAX));
+    }
+
+    SECTION("Random timestamps")
+    {
+        std::mt19937_64 generator(2026);
+
+        for (size_t i = 0; i < 10000; ++i)
+        {
+            // Many equal timestamps to check the stability.
+            add(generator() % 1000 * 0x10001);
+        }
+
+        SIGNAL::SignalCollectionT expected(collection);
+        std::stable_sort(expected.begin(), expected.end(), SIGNAL::PtrTimestampLtComparator());
+
+        SECTION("Single thread")
+        {
+            sorter.Sort(collection);
+
+            REQUIRE(collection == expected);
+        }
+
+        SECTION("Even number of threads")
+        {
+            const SIGNAL::SignalSorter parallelSorter(4, 100);
+            parallelSorter.Sort(collection);
+
+            REQUIRE(collection == expected);
+        }
+
+        SECTION("Odd number of threads")
+        {
+            const SIGNAL::SignalSorter parallelSorter(7, 1);
+            parallelSorter.Sort(collection);
+
+            REQUIRE(collection == expected);
+        }
+    }
+
+    SECTION("More threads than signals")
+    {
+        add(3);
+        add(1);
+        add(2);
+        add(1);
+
+        const SIGNAL::SignalSorter parallelSorter(16, 1);
+        parallelSorter.Sort(collection);
+
+        REQUIRE(collection[0]->Print() == "PRINT 1 Top.s");
+        REQUIRE(collection[1]->Print() == "PRINT 3 Top.s");
+        REQUIRE(collection[2]->Print() == "PRINT 2 Top.s");
+        REQUIRE(collection[3]->Print() == "PRINT 0 Top.s");
+    }
+}
@@ -0,0 +1,91 @@
+/// @file common/test/unitTest/SignalStructureBuilder.cpp
+///
+/// Unit test for SignalStructureBuilder class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <sstream>
+
+#include "catch.hpp"
+
+#include "SignalStructureBuilder.h"
+#include "stub/DummySignal.h"
+
+/// Unit test for SignalStructureBuilder class.
+TEST_CASE("SignalStructureBuilder")
+{
+    std::ostringstream output;
+
+    SECTION("Nested scopes")
+    {
+        DummySignal signal1("Top.Sub.a", 0);
+        DummySignal signal2("Top.Sub.b", 0);
+        DummySignal signal3("Top.c", 0);
+        DummySignal signal4("d", 0);
+
+        const SIGNAL::UniqueSignalsCollectionT signals{{signal1.GetName(), &signal1},
+                                                       {signal2.GetName(), &signal2},
+                                                       {signal3.GetName(), &signal3},
+                                                       {signal4.GetName(), &signal4}};
+
+        TRACER::SignalStructureBuilder(signals, output).Dump();
+
+        REQUIRE(output.str() ==
+                "$scope module Top $end\n"
+                "\t$scope module Sub $end\n"
+                "\t\t$var dummy 32 Top.Sub.a a $end\n"
+                "\t\t$var dummy 32 Top.Sub.b b $end\n"
+                "\t$upscope $end\n"
+                "\t$var dummy 32 Top.c c $end\n"
+                "$upscope $end\n"
+                "$var dummy 32 d d $end\n");
+    }
+
+    SECTION("Signal and scope of the same name")
+    {
+        DummySignal signal1("Top.a", 0);
+        DummySignal signal2("Top.a.b", 0);
+
+        const SIGNAL::UniqueSignalsCollectionT signals{{signal1.GetName(), &signal1},
+                                                       {signal2.GetName(), &signal2}};
+
+        TRACER::SignalStructureBuilder(signals, output).Dump();
+
+        REQUIRE(output.str() ==
+                "$scope module Top $end\n"
+                "\t$var dummy 32 Top.a a $end\n"
+                "\t$scope module a $end\n"
+                "\t\t$var dummy 32 Top.a.b b $end\n"
+                "\t$upscope $end\n"
+                "$upscope $end\n");
+    }
+
+    SECTION("No signals")
+    {
+        const SIGNAL::UniqueSignalsCollectionT signals;
+
+        TRACER::SignalStructureBuilder(signals, output).Dump();
+
+        REQUIRE(output.str().empty());
+    }
+}
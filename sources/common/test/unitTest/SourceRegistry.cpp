@@ -24,6 +24,11 @@
 /// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
 /// IN THE SOFTWARE.
 
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "catch.hpp"
 
 #include "SourceRegistry.h"
@@ -54,5 +59,45 @@ TEST_CASE("SourceRegistry")
         REQUIRE_THROWS(registry.GetSourceName(SIGNAL::SourceRegistry::BAD_HANDLE));
         REQUIRE_THROWS(registry.GetSourceName(handle1 + 1));
     }
+
+    SECTION("Concurrent registration")
+    {
+        const size_t threads = 4;
+        const size_t sources = 1000;
+
+        std::vector<std::vector<SIGNAL::SourceRegistry::HandleT>> handles(threads);
+        std::vector<std::thread> workers;
+
+        // All the threads register the same sources and read them back.
+        for (size_t thread = 0; thread < threads; ++thread)
+        {
+            workers.emplace_back([&registry, &handles, thread, sources]()
+            {
+                for (size_t source = 0; source < sources; ++source)
+                {
+                    const std::string name = "source" + std::to_string(source);
+                    const SIGNAL::SourceRegistry::HandleT handle = registry.Register(name);
+
+                    handles[thread].push_back((registry.GetSourceName(handle) == name) ?
+                                              handle : SIGNAL::SourceRegistry::BAD_HANDLE);
+                }
+            });
+        }
+
+        for (std::thread &rWorker : workers)
+        {
+            rWorker.join();
+        }
+
+        const std::set<SIGNAL::SourceRegistry::HandleT> uniqueHandles(handles[0].cbegin(), handles[0].cend());
+
+        REQUIRE(uniqueHandles.size() == sources);
+        REQUIRE(uniqueHandles.count(SIGNAL::SourceRegistry::BAD_HANDLE) == 0);
+
+        for (size_t thread = 1; thread < threads; ++thread)
+        {
+            REQUIRE(handles[thread] == handles[0]);
+        }
+    }
 }
 
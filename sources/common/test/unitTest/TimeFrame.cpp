@@ -0,0 +1,117 @@
+/// @file common/test/unitTest/TimeFrame.cpp
+///
+/// Unit test for TimeFrame class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <sstream>
+
+#include "catch.hpp"
+
+#include "TimeFrame.h"
+#include "stub/DummySignal.h"
+
+/// Unit test for TimeFrame class.
+TEST_CASE("TimeFrame")
+{
+    // Identifiers given in the order of the first occurrence.
+    DummySignal signalB("Top.b", 0, "1");
+    signalB.SetId(0);
+    DummySignal signalA("Top.a", 0, "1");
+    signalA.SetId(1);
+
+    const SIGNAL::UniqueSignalsCollectionT footprint{{signalA.GetName(), &signalA},
+                                                     {signalB.GetName(), &signalB}};
+
+    std::ostringstream output;
+    TRACER::TimeFrame frame(0, footprint, output);
+
+    SECTION("Signals dumped in the name order")
+    {
+        frame.Add(&signalB);
+        frame.Add(&signalA);
+        frame.DumpAndClear();
+
+        REQUIRE(output.str() == "#0\nPRINT 1 Top.a\nPRINT 1 Top.b\n");
+    }
+
+    SECTION("Unchanged values are not dumped")
+    {
+        DummySignal signalA2("Top.a", 2, "1");
+        signalA2.SetId(1);
+        DummySignal signalB2("Top.b", 2, "2");
+        signalB2.SetId(0);
+
+        frame.Add(&signalA);
+        frame.DumpAndClear();
+        frame.SetTime(2);
+        frame.Add(&signalA2);
+        frame.Add(&signalB2);
+        frame.DumpAndClear();
+
+        REQUIRE(output.str() == "#0\nPRINT 1 Top.a\n#2\nPRINT 2 Top.b\n");
+    }
+
+    SECTION("The last value within a frame is dumped")
+    {
+        DummySignal signalA2("Top.a", 0, "2");
+        signalA2.SetId(1);
+
+        frame.Add(&signalA);
+        frame.Add(&signalA2);
+        frame.DumpAndClear();
+
+        REQUIRE(output.str() == "#0\nPRINT 2 Top.a\n");
+    }
+
+    SECTION("Owning frame")
+    {
+        std::ostringstream owned_output;
+        TRACER::TimeFrame owning_frame(0, footprint, owned_output, true);
+
+        DummySignal *pSignalA = new DummySignal("Top.a", 0, "1");
+        pSignalA->SetId(1);
+        DummySignal *pSignalA2 = new DummySignal("Top.a", 1, "1");
+        pSignalA2->SetId(1);
+        DummySignal *pSignalA3 = new DummySignal("Top.a", 2, "3");
+        pSignalA3->SetId(1);
+
+        owning_frame.Add(pSignalA);
+        owning_frame.DumpAndClear();
+        owning_frame.SetTime(1);
+        owning_frame.Add(pSignalA2);
+        owning_frame.DumpAndClear();
+        owning_frame.SetTime(2);
+        owning_frame.Add(pSignalA3);
+        owning_frame.DumpAndClear();
+
+        REQUIRE(owned_output.str() == "#0\nPRINT 1 Top.a\n#2\nPRINT 3 Top.a\n");
+    }
+
+    SECTION("Empty frames are not dumped")
+    {
+        frame.DumpAndClear();
+
+        REQUIRE(output.str().empty());
+    }
+}
@@ -0,0 +1,124 @@
+/// @file common/test/unitTest/TimestampConverter.cpp
+///
+/// Unit test for TimestampConverter class.
+///
+/// @ingroup UnitTest
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <cstdint>
+
+#include "catch.hpp"
+
+#include "TimestampConverter.h"
+
+using UTILS::ConversionStatus;
+using UTILS::TimestampConverter;
+
+/// The time unit indexes.
+static const size_t S = 0;
+static const size_t MS = 1;
+static const size_t US = 2;
+static const size_t NS = 3;
+static const size_t FS = 5;
+
+/// Unit test for TimestampConverter class.
+TEST_CASE("TimestampConverter")
+{
+    uint64_t value = 0;
+
+    SECTION("Time of day")
+    {
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03:44.123456", US, value) == ConversionStatus::OK);
+        REQUIRE(value == 43424123456U);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03:44.123456", MS, value) == ConversionStatus::OK);
+        REQUIRE(value == 43424123U);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03:44.1", NS, value) == ConversionStatus::OK);
+        REQUIRE(value == 43424100000000U);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay(" 7:00:01 ", S, value) == ConversionStatus::OK);
+        REQUIRE(value == 25201U);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("23:59:60.999999999999999999", NS, value) == ConversionStatus::OK);
+        REQUIRE(value == 86400999999999U);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("00:00:00", FS, value) == ConversionStatus::OK);
+        REQUIRE(value == 0);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("23:59:59", FS, value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("24:00:00", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:60:00", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:3:44", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("123:03:44", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03:44.", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03:44.5garbage", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("12:03:445", US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("7:00:01 INFO", S, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertTimeOfDay("23:59:59 x", FS, value) == ConversionStatus::INVALID);
+    }
+
+    SECTION("Epoch")
+    {
+        REQUIRE(TimestampConverter::ConvertEpoch("1712345678.000123", US, value) == ConversionStatus::OK);
+        REQUIRE(value == 1712345678000123U);
+        REQUIRE(TimestampConverter::ConvertEpoch("1712345678.000123", NS, value) == ConversionStatus::OK);
+        REQUIRE(value == 1712345678000123000U);
+        REQUIRE(TimestampConverter::ConvertEpoch("1712345678.9", S, value) == ConversionStatus::OK);
+        REQUIRE(value == 1712345678U);
+        REQUIRE(TimestampConverter::ConvertEpoch(" 1712345678 ", MS, value) == ConversionStatus::OK);
+        REQUIRE(value == 1712345678000U);
+        REQUIRE(TimestampConverter::ConvertEpoch("18446744073.709551615", NS, value) == ConversionStatus::OK);
+        REQUIRE(value == 18446744073709551615U);
+        REQUIRE(TimestampConverter::ConvertEpoch("18446744073.709551616", NS, value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(TimestampConverter::ConvertEpoch("1712345678.000123", FS, value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(TimestampConverter::ConvertEpoch("123456789012345678901", S, value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(TimestampConverter::ConvertEpoch("-1", S, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertEpoch(".5", S, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertEpoch("17x", S, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertEpoch("1712345678,5", MS, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertEpoch("1712345678.5 s", MS, value) == ConversionStatus::INVALID);
+    }
+
+    SECTION("Decimal")
+    {
+        REQUIRE(TimestampConverter::ConvertDecimal("2.5", MS, US, value) == ConversionStatus::OK);
+        REQUIRE(value == 2500U);
+        REQUIRE(TimestampConverter::ConvertDecimal("2.5 ms", S, US, value) == ConversionStatus::OK);
+        REQUIRE(value == 2500U);
+        REQUIRE(TimestampConverter::ConvertDecimal("2.5s", MS, US, value) == ConversionStatus::OK);
+        REQUIRE(value == 2500000U);
+        REQUIRE(TimestampConverter::ConvertDecimal("1500 ns", S, US, value) == ConversionStatus::OK);
+        REQUIRE(value == 1U);
+        REQUIRE(TimestampConverter::ConvertDecimal("42", US, US, value) == ConversionStatus::OK);
+        REQUIRE(value == 42U);
+        REQUIRE(TimestampConverter::ConvertDecimal("42 ", MS, US, value) == ConversionStatus::OK);
+        REQUIRE(value == 42000U);
+        REQUIRE(TimestampConverter::ConvertDecimal("42 fs", S, FS, value) == ConversionStatus::OK);
+        REQUIRE(value == 42U);
+        REQUIRE(TimestampConverter::ConvertDecimal("18446744073709551616 fs", S, S, value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(TimestampConverter::ConvertDecimal("18446744073709552 ms", S, US, value) == ConversionStatus::OUT_OF_RANGE);
+        REQUIRE(TimestampConverter::ConvertDecimal("ms", S, US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertDecimal("1.ms", S, US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertDecimal("3 min", MS, NS, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertDecimal("42 status", MS, US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertDecimal("42 msx", S, US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertDecimal("2.5 ms x", S, US, value) == ConversionStatus::INVALID);
+        REQUIRE(TimestampConverter::ConvertDecimal("2.5x", MS, US, value) == ConversionStatus::INVALID);
+    }
+}
@@ -30,6 +30,9 @@
 
 #pragma once
 
+#include <istream>
+#include <ostream>
+
 #include "Signal.h"
 
 /// Dummy signal class.
@@ -79,6 +82,20 @@ class DummySignal : public SIGNAL::Signal
             return "FOOTPRINT " + GetName();
         }
 
+        /// @copydoc SIGNAL::Signal::Serialize()
+        virtual void Serialize(std::ostream &rOut) const
+        {
+            rOut << m_Value << '\n';
+        }
+
+        /// @copydoc SIGNAL::Signal::Deserialize()
+        virtual Signal *Deserialize(const TIME::Timestamp &rTimestamp, std::istream &rIn) const
+        {
+            std::string value;
+            std::getline(rIn, value);
+            return new DummySignal(GetName(), rTimestamp.GetValue(), value, GetSource());
+        }
+
     protected:
 
         /// @copydoc SIGNAL::Signal::EqualTo()
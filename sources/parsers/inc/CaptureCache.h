@@ -0,0 +1,185 @@
+/// @file parsers/inc/CaptureCache.h
+///
+/// The cache of the converted regex groups.
+///
+/// @par Full Description
+/// The cache keeps the values of the regex groups converted while evaluating
+/// the expressions of the matched log line, so that every group is converted
+/// at most once per line.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace PARSER
+{
+    /// The cache of the converted regex groups.
+    ///
+    /// The cache is shared by all the evaluators of a signal creator. It must
+    /// be reset whenever a new line is matched. Failed conversions are not
+    /// cached, so the error is reported by every expression using the group.
+    class CaptureCache
+    {
+        public:
+
+            /// The conversions of the regex groups.
+            enum class Conversion : uint8_t
+            {
+                DEC,
+                HEX,
+                FLT,
+                CONVERSIONS
+            };
+
+            /// The capture cache constructor.
+            CaptureCache() :
+                m_Entries(),
+                m_Generation(1)
+            {
+            }
+
+            /// Invalidates the values of the previous line.
+            void Reset()
+            {
+                ++m_Generation;
+            }
+
+            /// Looks up the integer value of the group.
+            ///
+            /// @param conversion The conversion of the group.
+            /// @param index The index of the regex group.
+            /// @param rValue The cached value.
+            /// @return True if the value has been found.
+            bool FindUint(Conversion conversion, size_t index, uint64_t &rValue) const
+            {
+                const Entry *pEntry = Find(conversion, index);
+                if (nullptr == pEntry)
+                {
+                    return false;
+                }
+                rValue = pEntry->m_Uint;
+                return true;
+            }
+
+            /// Looks up the float value of the group.
+            ///
+            /// @param index The index of the regex group.
+            /// @param rValue The cached value.
+            /// @return True if the value has been found.
+            bool FindFloat(size_t index, double &rValue) const
+            {
+                const Entry *pEntry = Find(Conversion::FLT, index);
+                if (nullptr == pEntry)
+                {
+                    return false;
+                }
+                rValue = pEntry->m_Float;
+                return true;
+            }
+
+            /// Stores the integer value of the group.
+            ///
+            /// @param conversion The conversion of the group.
+            /// @param index The index of the regex group.
+            /// @param value The converted value.
+            void StoreUint(Conversion conversion, size_t index, uint64_t value)
+            {
+                Store(conversion, index).m_Uint = value;
+            }
+
+            /// Stores the float value of the group.
+            ///
+            /// @param index The index of the regex group.
+            /// @param value The converted value.
+            void StoreFloat(size_t index, double value)
+            {
+                Store(Conversion::FLT, index).m_Float = value;
+            }
+
+        private:
+
+            /// A type of the line generation counter.
+            using GenerationT = uint64_t;
+
+            /// The converted value.
+            struct Entry
+            {
+                /// The line generation in which the value was converted.
+                GenerationT m_Generation;
+
+                /// The integer value.
+                uint64_t m_Uint;
+
+                /// The float value.
+                double m_Float;
+            };
+
+            /// Returns the position of the entry.
+            ///
+            /// @param conversion The conversion of the group.
+            /// @param index The index of the regex group.
+            static size_t GetPosition(Conversion conversion, size_t index)
+            {
+                return (index * static_cast<size_t>(Conversion::CONVERSIONS)) + static_cast<size_t>(conversion);
+            }
+
+            /// Returns the entry valid in the current line.
+            ///
+            /// @param conversion The conversion of the group.
+            /// @param index The index of the regex group.
+            /// @return The entry or nullptr if the group has not been converted.
+            const Entry *Find(Conversion conversion, size_t index) const
+            {
+                const size_t position = GetPosition(conversion, index);
+                if ((position < m_Entries.size()) && (m_Entries[position].m_Generation == m_Generation))
+                {
+                    return &m_Entries[position];
+                }
+                return nullptr;
+            }
+
+            /// Returns the entry marked as valid in the current line.
+            ///
+            /// @param conversion The conversion of the group.
+            /// @param index The index of the regex group.
+            Entry &Store(Conversion conversion, size_t index)
+            {
+                const size_t position = GetPosition(conversion, index);
+                if (position >= m_Entries.size())
+                {
+                    m_Entries.resize(position + 1, Entry{0, 0, 0.0});
+                }
+                m_Entries[position].m_Generation = m_Generation;
+                return m_Entries[position];
+            }
+
+            /// The converted values indexed by the group and the conversion.
+            std::vector<Entry> m_Entries;
+
+            /// The current line generation.
+            GenerationT m_Generation;
+    };
+}
@@ -0,0 +1,106 @@
+/// @file parsers/inc/CaptureGroups.h
+///
+/// The groups of the matched log line.
+///
+/// @par Full Description
+/// The groups of the log line the expressions are evaluated over. They are
+/// either the regex groups or the fields of a delimiter-separated line.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+
+#pragma once
+
+#include <cstddef>
+#include <regex>
+#include <string_view>
+
+namespace PARSER
+{
+    /// The groups of the matched log line.
+    ///
+    /// The groups are either the groups of the regular expression matching
+    /// the line or the fields of the line split at the delimiter. Group 0
+    /// is always the whole line. The groups only refer to the line, so they
+    /// are valid as long as the line.
+    class CaptureGroups
+    {
+        public:
+
+            /// The constructor of the regex groups.
+            ///
+            /// @param rMatch The matched regular expression groups.
+            CaptureGroups(const std::smatch &rMatch) :
+                m_pMatch(&rMatch),
+                m_pFields(nullptr),
+                m_FieldCount(0)
+            {
+            }
+
+            /// The constructor of the line fields.
+            ///
+            /// @param pFields The line followed by its fields.
+            /// @param fieldCount The number of the fields including the line.
+            CaptureGroups(const std::string_view *pFields, size_t fieldCount) :
+                m_pMatch(nullptr),
+                m_pFields(pFields),
+                m_FieldCount(fieldCount)
+            {
+            }
+
+            /// Returns the number of the groups including the whole line.
+            size_t GetSize() const
+            {
+                return (nullptr != m_pMatch) ? m_pMatch->size() : m_FieldCount;
+            }
+
+            /// Returns the group.
+            ///
+            /// @param index The index of the group.
+            /// @return The view of the group or the empty view if there is no such group.
+            std::string_view GetGroup(size_t index) const
+            {
+                if (nullptr == m_pMatch)
+                {
+                    return (index < m_FieldCount) ? m_pFields[index] : std::string_view();
+                }
+
+                const std::ssub_match &rGroup = (*m_pMatch)[index];
+                if (0 == rGroup.length())
+                {
+                    return std::string_view();
+                }
+                return std::string_view(&*rGroup.first, static_cast<size_t>(rGroup.length()));
+            }
+
+        private:
+            /// The regex groups or nullptr if the line has been split.
+            const std::smatch *m_pMatch;
+
+            /// The line fields.
+            const std::string_view *m_pFields;
+
+            /// The number of the line fields.
+            size_t m_FieldCount;
+    };
+}
@@ -29,13 +29,25 @@
 
 #pragma once
 
+#include <string_view>
 #include <vector>
 
 #include "ExpressionNode.h"
 #include "ExpressionContext.h"
+#include "ExpressionProgram.h"
 
 namespace PARSER
 {
+    /// Converts the regex group to an integer.
+    ///
+    /// @throws ConversionError if the group is not a number.
+    /// @throws Overflow if the number is out of range.
+    /// @param element The regex group.
+    /// @param base The base of the number.
+    /// @param pConversionError The conversion error message.
+    /// @return The integer value.
+    SafeUInt<uint64_t> ConvertElement(std::string_view element, int base, const char *pConversionError);
+
     /// The class represents the constant node type.
     class DNConstant : public ExpressionNode
     {
@@ -58,6 +70,18 @@ namespace PARSER
             {
                 return m_Value;
             }
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.Emit(ExpressionProgram::OpCode::UINT_CONSTANT, m_Value.GetValue());
+            }
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return true;
+            }
     };
 
     /// The class represents the constant node type based on a decimal string.
@@ -82,6 +106,12 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateUint()
             virtual SafeUInt<uint64_t> EvaluateUint() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.Emit(ExpressionProgram::OpCode::UINT_DEC, m_Index);
+            }
     };
 
     /// The class represents the constant node type based on a hexadecimal string.
@@ -106,6 +136,12 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateUint()
             virtual SafeUInt<uint64_t> EvaluateUint() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.Emit(ExpressionProgram::OpCode::UINT_HEX, m_Index);
+            }
     };
 
     /// The class represents the constant type of nodes based on a log line number.
@@ -126,6 +162,12 @@ namespace PARSER
             {
                 return m_rContext.GetLineNo();
             }
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.Emit(ExpressionProgram::OpCode::UINT_LINE);
+            }
     };
 
     /// The class represents the addition node type.
@@ -157,6 +199,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateUint()
             virtual SafeUInt<uint64_t> EvaluateUint() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 
     /// The class represents the subtraction node type.
@@ -188,6 +239,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateUint()
             virtual SafeUInt<uint64_t> EvaluateUint() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 
     /// The class represents the multiplication node type.
@@ -219,6 +279,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateUint()
             virtual SafeUInt<uint64_t> EvaluateUint() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 
     /// The class represents the division node type.
@@ -250,5 +319,14 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateUint()
             virtual SafeUInt<uint64_t> EvaluateUint() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 }
@@ -32,6 +32,7 @@
 
 #include "ExpressionNode.h"
 #include "ExpressionContext.h"
+#include "ExpressionProgram.h"
 
 namespace PARSER
 {
@@ -67,28 +68,36 @@ namespace PARSER
             /// @throws ParsingError On parsing error.
             void ParseStringString(const std::string &inString);
 
-            /// Set the expression context.
-            ///
-            /// The expression is fixed. It is the expression context that
-            /// changes over time and must be set with new values.
-            ///
-            /// @param pGroups The pointer to the parsed regex groups.
-            /// @param lineNo The log line number.
-            void SetContext(const std::smatch *pGroups, uint64_t lineNo) const;
+            /// The evaluator owns the parsed expression.
+            Evaluator(const Evaluator &) = delete;
+
+            /// The evaluator owns the parsed expression.
+            Evaluator &operator=(const Evaluator &) = delete;
 
-            /// Returns the calculation context.
+            /// Returns the parsing context.
             ///
-            /// @return The calculation context.
-            ExpressionContext &GetContext() const;
+            /// The parser creates the expression nodes within this context.
+            ///
+            /// @return The parsing context.
+            ExpressionContext &GetContext();
 
             /// Evaluates the expression expecting the 'double' value.
-            std::string EvaluateDouble() const;
+            ///
+            /// The evaluator is not modified, so it may be shared by threads
+            /// evaluating their own contexts.
+            ///
+            /// @param rContext The context of the matched line.
+            std::string EvaluateDouble(const ExpressionContext &rContext) const;
 
             /// Evaluates the expression expecting the 'uint' value.
-            uint64_t EvaluateUint() const;
+            ///
+            /// @param rContext The context of the matched line.
+            uint64_t EvaluateUint(const ExpressionContext &rContext) const;
 
             /// Evaluates the expression expecting the 'string' value.
-            std::string EvaluateString() const;
+            ///
+            /// @param rContext The context of the matched line.
+            std::string EvaluateString(const ExpressionContext &rContext) const;
 
             /// Sets the syntax error index.
             void SetSyntaxErrorIndex(size_t index)
@@ -97,16 +106,17 @@ namespace PARSER
             }
 
             /// The lexer pointer must be a public interface as it is
-            /// the expected lexer interface.
+            /// the expected lexer interface. The lexers exist only while
+            /// the expression is being parsed.
 
             /// The decimal(vector) lexer.
-            class DecimalScanner *m_pDecimalLexer;
+            class DecimalScanner *m_pDecimalLexer = nullptr;
 
             /// The float lexer.
-            class FloatScanner *m_pFloatLexer;
+            class FloatScanner *m_pFloatLexer = nullptr;
 
             /// The string lexer.
-            class StringScanner *m_pStringLexer;
+            class StringScanner *m_pStringLexer = nullptr;
 
         private:
             /// Parses the input decimal stream.
@@ -127,6 +137,9 @@ namespace PARSER
             /// @return True if successfully parsed.
             bool ParseStringStream(std::istream &inStream);
 
+            /// Compiles the parsed expression.
+            void CompileExpression();
+
             /// Prints parsing error message.
             std::string ParsingErrorMessage(const std::string &parsedExpression) const;
 
@@ -142,7 +155,10 @@ namespace PARSER
             /// The evaluated expression.
             std::string m_Expression;
 
-            /// Calculation context.
-            mutable ExpressionContext m_Context;
+            /// The parsing context owning the expression.
+            ExpressionContext m_Context;
+
+            /// The compiled expression.
+            ExpressionProgram m_Program;
     };
 }
@@ -4,7 +4,7 @@
 ///
 /// @par Full Description
 /// The class provides the context for calculating the expressions value.
-/// These are the regex groups as well as the log line number.
+/// These are the log line groups as well as the log line number.
 ///
 /// @ingroup Parser
 ///
@@ -31,9 +31,11 @@
 #pragma once
 
 #include <string>
-#include <regex>
+#include <string_view>
 
 #include "ExpressionNode.h"
+#include "CaptureCache.h"
+#include "CaptureGroups.h"
 
 namespace PARSER
 {
@@ -49,14 +51,23 @@ namespace PARSER
             /// It creates the expression context which is later used during
             /// calculating the expression's value.
             ///
-            /// @param pGroups The pointer to the parsed regex groups.
+            /// @param pGroups The pointer to the groups of the log line.
             /// @param lineNo The log line number.
-            ExpressionContext(std::smatch *pGroups, uint64_t lineNo) :
+            /// @param pCache The pointer to the cache shared with other
+            ///               expressions of the line or nullptr.
+            ExpressionContext(const CaptureGroups *pGroups, uint64_t lineNo, CaptureCache *pCache = nullptr) :
                 m_pGroups(pGroups),
                 m_LineNo(lineNo),
-                m_pExpression(nullptr)
+                m_pExpression(nullptr),
+                m_pCache(pCache)
             {}
 
+            /// The context owns the expression.
+            ExpressionContext(const ExpressionContext &) = delete;
+
+            /// The context owns the expression.
+            ExpressionContext &operator=(const ExpressionContext &) = delete;
+
             /// Expression context destructor.
             ~ExpressionContext()
             {
@@ -68,9 +79,9 @@ namespace PARSER
             /// The expression is fixed. It is the expression context that
             /// changes over time and must be set with new values.
             ///
-            /// @param pGroups The pointer to the parsed regex groups.
+            /// @param pGroups The pointer to the groups of the log line.
             /// @param lineNo The log line number.
-            void Set(const std::smatch *pGroups, uint64_t lineNo)
+            void Set(const CaptureGroups *pGroups, uint64_t lineNo)
             {
                 m_pGroups = pGroups;
                 m_LineNo = lineNo;
@@ -78,18 +89,28 @@ namespace PARSER
 
             /// Return the string for the given regex group.
             ///
-            /// The string related to the regex group specified
-            /// by the index is returned.
+            /// The view of the log line part related to the regex group
+            /// or the line field specified by the index is returned.
+            /// It is valid as long as the matched line.
             ///
             /// @param index The index of the regex group content to be returned.
             /// @return String representing the given regex group.
-            const std::string GetElement(size_t index) const
+            std::string_view GetElement(size_t index) const
             {
-                if (index > m_pGroups->size())
+                if (index > m_pGroups->GetSize())
                 {
                     throw EXCEPTIONS::IndexOutOfRange("Regex group index out of range: " + std::to_string(index));
                 }
-                return (*m_pGroups)[index].str();
+
+                return m_pGroups->GetGroup(index);
+            }
+
+            /// Return the cache of the converted regex groups.
+            ///
+            /// @return The cache pointer or nullptr if groups are not cached.
+            CaptureCache *GetCache() const
+            {
+                return m_pCache;
             }
 
             /// Return the log line number.
@@ -123,13 +144,16 @@ namespace PARSER
             }
 
         private:
-            /// A pointer to the regex groups (the context of the expression).
-            const std::smatch *m_pGroups;
+            /// A pointer to the log line groups (the context of the expression).
+            const CaptureGroups *m_pGroups;
 
             /// The log line number.
             uint64_t m_LineNo;
 
             /// The expression.
             ExpressionNode *m_pExpression;
+
+            /// The cache of the converted regex groups.
+            CaptureCache *m_pCache;
     };
 }
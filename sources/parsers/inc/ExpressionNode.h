@@ -40,6 +40,9 @@ namespace PARSER
     /// Forward declaration of the expression context class.
     class ExpressionContext;
 
+    /// Forward declaration of the expression program class.
+    class ExpressionProgram;
+
     /// The abstract expression node.
     ///
     /// The class defines the expression node interface.
@@ -76,6 +79,17 @@ namespace PARSER
                 return "";
             }
 
+            /// Compiles the tree into the program.
+            ///
+            /// @param rProgram The program the instructions are appended to.
+            virtual void Compile(ExpressionProgram &rProgram) const = 0;
+
+            /// Returns true if the tree does not depend on the log line.
+            virtual bool IsConstant() const
+            {
+                return false;
+            }
+
         protected:
             /// The beginning of the index string.
             const size_t FIRST_STRING_CHARACTER_POS = 4;
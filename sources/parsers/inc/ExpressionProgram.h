@@ -0,0 +1,257 @@
+/// @file parsers/inc/ExpressionProgram.h
+///
+/// The expression program.
+///
+/// @par Full Description
+/// The expression tree compiled into a linear program of a stack machine.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "SafeUInt.h"
+#include "FloatResult.h"
+#include "CaptureCache.h"
+
+namespace PARSER
+{
+    /// Forward declaration of the expression node class.
+    class ExpressionNode;
+
+    /// Forward declaration of the expression context class.
+    class ExpressionContext;
+
+    /// The expression program class.
+    ///
+    /// The expression tree is compiled once into a flat sequence of
+    /// instructions which is then executed for every matched line. The
+    /// subtrees which do not depend on the log line are folded into constants.
+    /// The operands are evaluated in the same order as the tree evaluated
+    /// them, so the same diagnostics are reported.
+    class ExpressionProgram
+    {
+        public:
+
+            /// The instruction codes.
+            enum class OpCode : uint8_t
+            {
+                UINT_CONSTANT,
+                UINT_DEC,
+                UINT_HEX,
+                UINT_LINE,
+                UINT_ADD,
+                UINT_SUBTRACT,
+                UINT_MULTIPLY,
+                UINT_CHECK_DIVISOR,
+                UINT_DIVIDE,
+                FLOAT_CONSTANT,
+                FLOAT_FLT,
+                FLOAT_NEGATE,
+                FLOAT_ADD,
+                FLOAT_SUBTRACT,
+                FLOAT_MULTIPLY,
+                FLOAT_DIVIDE,
+                STRING_CONSTANT,
+                STRING_TXT
+            };
+
+            /// The expression program constructor.
+            ExpressionProgram();
+
+            /// Compiles the expression tree.
+            ///
+            /// The previous program is discarded.
+            ///
+            /// @param rExpression The root of the expression tree.
+            void Compile(const ExpressionNode &rExpression);
+
+            /// Appends the instruction.
+            ///
+            /// The integer operands must be emitted right to left and the float
+            /// operands left to right, following the evaluation order of the tree.
+            ///
+            /// @param opCode The instruction code.
+            /// @param operand The constant value or the regex group index.
+            void Emit(OpCode opCode, uint64_t operand = 0);
+
+            /// Appends the float constant.
+            ///
+            /// @param value The constant value.
+            void EmitFloat(double value);
+
+            /// Appends the string constant.
+            ///
+            /// It is merged with the preceding string constant, if any.
+            ///
+            /// @param rString The constant string.
+            void EmitString(const std::string &rString);
+
+            /// Folds the constant 'uint' tree.
+            ///
+            /// The tree is left to be compiled if it is not constant or if
+            /// evaluating it fails, so that the error is reported per line.
+            ///
+            /// @param rNode The root of the folded tree.
+            /// @return True if the tree has been replaced with a constant.
+            bool FoldUint(const ExpressionNode &rNode);
+
+            /// Folds the constant 'double' tree.
+            ///
+            /// @copydetails FoldUint()
+            bool FoldDouble(const ExpressionNode &rNode);
+
+            /// Executes the program expecting the 'uint' value.
+            ///
+            /// @param rContext The context of the matched line.
+            /// @return The expression value.
+            SafeUInt<uint64_t> EvaluateUint(const ExpressionContext &rContext) const;
+
+            /// Executes the program expecting the 'double' value.
+            ///
+            /// A sole flt() keeps the original text of the value.
+            ///
+            /// @param rContext The context of the matched line.
+            /// @return The expression value.
+            FloatResult EvaluateDouble(const ExpressionContext &rContext) const;
+
+            /// Executes the program expecting the 'string' value.
+            ///
+            /// @param rContext The context of the matched line.
+            /// @return The expression value.
+            std::string EvaluateString(const ExpressionContext &rContext) const;
+
+            /// Returns the number of instructions.
+            size_t GetSize() const
+            {
+                return m_Code.size();
+            }
+
+        private:
+
+            /// Converts the integer regex group.
+            ///
+            /// The value is taken from the cache of the context, if available.
+            ///
+            /// @param rContext The context of the matched line.
+            /// @param index The index of the regex group.
+            /// @param conversion The conversion of the group.
+            /// @return The integer value.
+            static SafeUInt<uint64_t> ConvertUint(const ExpressionContext &rContext,
+                                                  size_t index,
+                                                  CaptureCache::Conversion conversion);
+
+            /// Converts the float regex group.
+            ///
+            /// The value is taken from the cache of the context, if available.
+            ///
+            /// @param rContext The context of the matched line.
+            /// @param index The index of the regex group.
+            /// @return The float value.
+            static FloatResult ConvertFloat(const ExpressionContext &rContext, size_t index);
+
+            /// The depth of the stack allocated by the caller.
+            static const size_t LOCAL_STACK_SIZE = 16;
+
+            /// The program instruction.
+            struct Instruction
+            {
+                /// The instruction code.
+                OpCode m_OpCode;
+
+                /// The integer constant, the regex group or the string index.
+                uint64_t m_Operand;
+
+                /// The float constant.
+                double m_Float;
+            };
+
+            /// The evaluation stack.
+            ///
+            /// Shallow programs use the stack of the caller, so executing
+            /// them allocates nothing.
+            template<class T>
+            class Stack
+            {
+                public:
+
+                    /// The stack constructor.
+                    ///
+                    /// @param depth The maximum depth of the stack.
+                    Stack(size_t depth) :
+                        m_Local(),
+                        m_Heap(),
+                        m_pTop(m_Local)
+                    {
+                        if (depth > LOCAL_STACK_SIZE)
+                        {
+                            m_Heap.resize(depth);
+                            m_pTop = m_Heap.data();
+                        }
+                    }
+
+                    /// Pushes the value.
+                    void Push(const T &rValue)
+                    {
+                        *m_pTop++ = rValue;
+                    }
+
+                    /// Pops the value.
+                    T Pop()
+                    {
+                        return *--m_pTop;
+                    }
+
+                    /// Returns the top value.
+                    const T &Top() const
+                    {
+                        return *(m_pTop - 1);
+                    }
+
+                private:
+
+                    /// The stack of shallow programs.
+                    T m_Local[LOCAL_STACK_SIZE];
+
+                    /// The stack of deep programs.
+                    std::vector<T> m_Heap;
+
+                    /// The first free slot.
+                    T *m_pTop;
+            };
+
+            /// The instructions.
+            std::vector<Instruction> m_Code;
+
+            /// The string constants.
+            std::vector<std::string> m_Strings;
+
+            /// The stack depth after the last instruction.
+            size_t m_Depth;
+
+            /// The maximum stack depth.
+            size_t m_MaxDepth;
+    };
+}
@@ -35,6 +35,7 @@
 
 #include "ExpressionNode.h"
 #include "ExpressionContext.h"
+#include "ExpressionProgram.h"
 
 namespace PARSER
 {
@@ -60,6 +61,18 @@ namespace PARSER
             {
                 return FloatResult(m_Value);
             }
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.EmitFloat(m_Value);
+            }
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return true;
+            }
     };
 
     /// The class represents the constant node type based on a float string.
@@ -84,6 +97,12 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateDouble()
             virtual FloatResult EvaluateDouble() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.Emit(ExpressionProgram::OpCode::FLOAT_FLT, m_Index);
+            }
     };
 
     /// The class represents the negate node type.
@@ -110,6 +129,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateDouble()
             virtual FloatResult EvaluateDouble() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pNode->IsConstant();
+            }
     };
 
     /// The class represents the addition node type.
@@ -141,6 +169,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateDouble()
             virtual FloatResult EvaluateDouble() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 
     /// The class represents the subtraction node type.
@@ -172,6 +209,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateDouble()
             virtual FloatResult EvaluateDouble() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 
     /// The class represents the multiplication node type.
@@ -203,6 +249,15 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateDouble()
             virtual FloatResult EvaluateDouble() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 
     /// The class represents the division node type.
@@ -234,5 +289,14 @@ namespace PARSER
 
             /// @copydoc ExpressionNode::EvaluateDouble()
             virtual FloatResult EvaluateDouble() const;
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const;
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return m_pLeft->IsConstant() && m_pRight->IsConstant();
+            }
     };
 }
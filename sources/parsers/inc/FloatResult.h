@@ -30,6 +30,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 namespace PARSER
 {
@@ -39,15 +40,28 @@ namespace PARSER
         public:
             /// The string based float constructor.
             ///
-            /// @param rFloatString The string from which the float result is constructed.
-            FloatResult(const std::string &rFloatString);
+            /// The string is referenced, so it must outlive the result.
+            ///
+            /// @param floatString The string from which the float result is constructed.
+            FloatResult(std::string_view floatString);
+
+            /// The converted float constructor.
+            ///
+            /// The string is referenced, so it must outlive the result.
+            ///
+            /// @param floatString The string from which the float result has been converted.
+            /// @param floatValue The converted value.
+            FloatResult(std::string_view floatString, double floatValue) :
+                m_Value(floatValue),
+                m_String(floatString)
+            {}
 
             /// The direct float constructor.
             ///
             /// @param floatValue The float value from which the float result is constructed.
             FloatResult(double floatValue) :
                 m_Value(floatValue),
-                m_String("")
+                m_String()
             {}
 
             /// Returns the value of the float result.
@@ -65,6 +79,6 @@ namespace PARSER
             double m_Value;
 
             /// The float string.
-            const std::string m_String;
+            std::string_view m_String;
     };
 }
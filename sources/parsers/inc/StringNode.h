@@ -33,6 +33,7 @@
 
 #include "ExpressionNode.h"
 #include "ExpressionContext.h"
+#include "ExpressionProgram.h"
 
 namespace PARSER
 {
@@ -67,6 +68,18 @@ namespace PARSER
 
                 return std::string(*m_pString, SKIP_FIRST_QUOTE, m_pString->length() - TWO_QUOTE_SIGNS);
             }
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.EmitString(EvaluateString());
+            }
+
+            /// @copydoc ExpressionNode::IsConstant()
+            virtual bool IsConstant() const
+            {
+                return true;
+            }
     };
 
     /// The class represents the string node.
@@ -92,7 +105,13 @@ namespace PARSER
             /// @copydoc ExpressionNode::EvaluateString()
             virtual std::string EvaluateString() const
             {
-                return m_rContext.GetElement(m_Index);
+                return std::string(m_rContext.GetElement(m_Index));
+            }
+
+            /// @copydoc ExpressionNode::Compile()
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                rProgram.Emit(ExpressionProgram::OpCode::STRING_TXT, m_Index);
             }
     };
 
@@ -128,5 +147,15 @@ namespace PARSER
             {
                 return m_pLeft->EvaluateString() + m_pRight->EvaluateString();
             }
+
+            /// @copydoc ExpressionNode::Compile()
+            ///
+            /// The string program is the sequence of the concatenated parts,
+            /// so adjacent constants are merged.
+            virtual void Compile(ExpressionProgram &rProgram) const
+            {
+                m_pLeft->Compile(rProgram);
+                m_pRight->Compile(rProgram);
+            }
     };
 }
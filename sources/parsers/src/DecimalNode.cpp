@@ -28,42 +28,33 @@
 /// IN THE SOFTWARE.
 
 #include "DecimalNode.h"
+#include "NumberConverter.h"
 
 SafeUInt<uint64_t> PARSER::DNDec::EvaluateUint() const
 {
-    SafeUInt<uint64_t> value = 0;
-    std::string stringValue(m_rContext.GetElement(m_Index));
-    try
-    {
-        value = std::stoll(stringValue.c_str(), nullptr, 10);
-    }
-    catch (const std::out_of_range &)
-    {
-        throw EXCEPTIONS::Overflow("Out of range decimal value: " + stringValue);
-    }
-    catch (const std::invalid_argument &)
-    {
-        throw EXCEPTIONS::ConversionError("Cannot convert to decimal: ", stringValue);
-    }
-
-    return value;
+    return ConvertElement(m_rContext.GetElement(m_Index), 10, "Cannot convert to decimal: ");
 }
 
 SafeUInt<uint64_t> PARSER::DNHex::EvaluateUint() const
 {
-    SafeUInt<uint64_t> value = 0;
-    std::string stringValue(m_rContext.GetElement(m_Index));
-    try
-    {
-        value = std::stoll(stringValue.c_str(), nullptr, 16);
-    }
-    catch (const std::out_of_range &)
+    return ConvertElement(m_rContext.GetElement(m_Index), 16, "Cannot convert to hex: ");
+}
+
+SafeUInt<uint64_t> PARSER::ConvertElement(std::string_view element, int base, const char *pConversionError)
+{
+    uint64_t value = 0;
+    const UTILS::ConversionStatus status = (16 == base) ?
+                                           UTILS::NumberConverter::ConvertHex(element, value) :
+                                           UTILS::NumberConverter::ConvertDecimal(element, value);
+
+    if (UTILS::ConversionStatus::INVALID == status)
     {
-        throw EXCEPTIONS::Overflow("Out of range decimal value: " + stringValue);
+        throw EXCEPTIONS::ConversionError(pConversionError, std::string(element));
     }
-    catch (const std::invalid_argument &)
+
+    if (UTILS::ConversionStatus::OUT_OF_RANGE == status)
     {
-        throw EXCEPTIONS::ConversionError("Cannot convert to hex: ", stringValue);
+        throw EXCEPTIONS::Overflow("Out of range decimal value: " + std::string(element));
     }
 
     return value;
@@ -114,3 +105,44 @@ SafeUInt<uint64_t> PARSER::DNDivide::EvaluateUint() const
     }
     return m_pLeft->EvaluateUint() / rightValue;
 }
+
+void PARSER::DNAdd::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldUint(*this))
+    {
+        m_pRight->Compile(rProgram);
+        m_pLeft->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::UINT_ADD);
+    }
+}
+
+void PARSER::DNSubtract::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldUint(*this))
+    {
+        m_pRight->Compile(rProgram);
+        m_pLeft->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::UINT_SUBTRACT);
+    }
+}
+
+void PARSER::DNMultiply::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldUint(*this))
+    {
+        m_pRight->Compile(rProgram);
+        m_pLeft->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::UINT_MULTIPLY);
+    }
+}
+
+void PARSER::DNDivide::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldUint(*this))
+    {
+        m_pRight->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::UINT_CHECK_DIVISOR);
+        m_pLeft->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::UINT_DIVIDE);
+    }
+}
@@ -52,7 +52,8 @@
 
 PARSER::Evaluator::Evaluator(const std::string &rSourceName) :
     m_rSourceName(rSourceName),
-    m_Context(nullptr, 0)
+    m_Context(nullptr, 0),
+    m_Program()
 {
 }
 
@@ -64,6 +65,7 @@ void PARSER::Evaluator::ParseDecimalString(const std::string &input)
         throw PARSER::EXCEPTIONS::ParsingError(ParsingErrorMessage(input));
     }
     m_Expression = input;
+    CompileExpression();
 }
 
 void PARSER::Evaluator::ParseFloatString(const std::string &input)
@@ -74,6 +76,7 @@ void PARSER::Evaluator::ParseFloatString(const std::string &input)
         throw PARSER::EXCEPTIONS::ParsingError(ParsingErrorMessage(input));
     }
     m_Expression = input;
+    CompileExpression();
 }
 
 void PARSER::Evaluator::ParseStringString(const std::string &input)
@@ -84,24 +87,20 @@ void PARSER::Evaluator::ParseStringString(const std::string &input)
         throw PARSER::EXCEPTIONS::ParsingError(ParsingErrorMessage(input));
     }
     m_Expression = input;
+    CompileExpression();
 }
 
-void PARSER::Evaluator::SetContext(const std::smatch *pGroups, uint64_t lineNo) const
-{
-    m_Context.Set(pGroups, lineNo);
-}
-
-PARSER::ExpressionContext &PARSER::Evaluator::GetContext() const
+PARSER::ExpressionContext &PARSER::Evaluator::GetContext()
 {
     return m_Context;
 }
 
-std::string PARSER::Evaluator::EvaluateDouble() const
+std::string PARSER::Evaluator::EvaluateDouble(const ExpressionContext &rContext) const
 {
     std::string stringValue;
     try
     {
-        stringValue = m_Context.GetExpression()->EvaluateDouble().GetFloatString();
+        stringValue = m_Program.EvaluateDouble(rContext).GetFloatString();
     }
     catch (const EXCEPTIONS::EvaluatorException &evaluatorError)
     {
@@ -111,11 +110,11 @@ std::string PARSER::Evaluator::EvaluateDouble() const
     return stringValue;
 }
 
-uint64_t PARSER::Evaluator::EvaluateUint() const
+uint64_t PARSER::Evaluator::EvaluateUint(const ExpressionContext &rContext) const
 {
     try
     {
-        return m_Context.GetExpression()->EvaluateUint().GetValue();
+        return m_Program.EvaluateUint(rContext).GetValue();
     }
     catch (const PARSER::EXCEPTIONS::EvaluatorException &evaluatorError)
     {
@@ -123,11 +122,11 @@ uint64_t PARSER::Evaluator::EvaluateUint() const
     }
 }
 
-std::string PARSER::Evaluator::EvaluateString() const
+std::string PARSER::Evaluator::EvaluateString(const ExpressionContext &rContext) const
 {
     try
     {
-        return m_Context.GetExpression()->EvaluateString();
+        return m_Program.EvaluateString(rContext);
     }
     catch (const PARSER::EXCEPTIONS::EvaluatorException &evaluatorError)
     {
@@ -147,7 +146,11 @@ bool PARSER::Evaluator::ParseDecimalStream(std::istream &in)
     #if defined(PARSER_DEBUG)
     parser.set_debug_level(1);
     #endif
-    return (parser.parse() == 0);
+    const bool parsed = (parser.parse() == 0);
+
+    // The scanner does not outlive the parsing.
+    m_pDecimalLexer = nullptr;
+    return parsed;
 }
 
 bool PARSER::Evaluator::ParseFloatStream(std::istream &in)
@@ -162,7 +165,11 @@ bool PARSER::Evaluator::ParseFloatStream(std::istream &in)
     #if defined(PARSER_DEBUG)
     parser.set_debug_level(1);
     #endif
-    return (parser.parse() == 0);
+    const bool parsed = (parser.parse() == 0);
+
+    // The scanner does not outlive the parsing.
+    m_pFloatLexer = nullptr;
+    return parsed;
 }
 
 bool PARSER::Evaluator::ParseStringStream(std::istream &in)
@@ -177,7 +184,20 @@ bool PARSER::Evaluator::ParseStringStream(std::istream &in)
     #if defined(PARSER_DEBUG)
     parser.set_debug_level(1);
     #endif
-    return (parser.parse() == 0);
+    const bool parsed = (parser.parse() == 0);
+
+    // The scanner does not outlive the parsing.
+    m_pStringLexer = nullptr;
+    return parsed;
+}
+
+void PARSER::Evaluator::CompileExpression()
+{
+    const ExpressionNode *pExpression = m_Context.GetExpression();
+    if (nullptr != pExpression)
+    {
+        m_Program.Compile(*pExpression);
+    }
 }
 
 std::string PARSER::Evaluator::ParsingErrorMessage(const std::string &parsedExpression) const
@@ -0,0 +1,405 @@
+/// @file parsers/src/ExpressionProgram.cpp
+///
+/// The expression program.
+///
+/// @par Full Description
+/// The expression tree compiled into a linear program of a stack machine.
+///
+/// @ingroup Parser
+///
+/// @par Copyright (c) 2026 vcdMaker team
+///
+/// Permission is hereby granted, free of charge, to any person obtaining a
+/// copy of this software and associated documentation files (the "Software"),
+/// to deal in the Software without restriction, including without limitation
+/// the rights to use, copy, modify, merge, publish, distribute, sublicense,
+/// and/or sell copies of the Software, and to permit persons to whom the
+/// Software is furnished to do so, subject to the following conditions:
+///
+/// The above copyright notice and this permission notice shall be included
+/// in all copies or substantial portions of the Software.
+///
+/// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+/// OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+/// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+/// THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+/// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+/// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+/// IN THE SOFTWARE.
+
+#include <algorithm>
+#include <limits>
+
+#include "ExpressionProgram.h"
+#include "ExpressionContext.h"
+#include "DecimalNode.h"
+
+PARSER::ExpressionProgram::ExpressionProgram() :
+    m_Code(),
+    m_Strings(),
+    m_Depth(0),
+    m_MaxDepth(0)
+{
+}
+
+void PARSER::ExpressionProgram::Compile(const ExpressionNode &rExpression)
+{
+    m_Code.clear();
+    m_Strings.clear();
+    m_Depth = 0;
+    m_MaxDepth = 0;
+
+    rExpression.Compile(*this);
+}
+
+void PARSER::ExpressionProgram::Emit(OpCode opCode, uint64_t operand)
+{
+    switch (opCode)
+    {
+        case OpCode::UINT_CONSTANT:
+        case OpCode::UINT_DEC:
+        case OpCode::UINT_HEX:
+        case OpCode::UINT_LINE:
+        case OpCode::FLOAT_CONSTANT:
+        case OpCode::FLOAT_FLT:
+            ++m_Depth;
+            break;
+
+        case OpCode::UINT_ADD:
+        case OpCode::UINT_SUBTRACT:
+        case OpCode::UINT_MULTIPLY:
+        case OpCode::UINT_DIVIDE:
+        case OpCode::FLOAT_ADD:
+        case OpCode::FLOAT_SUBTRACT:
+        case OpCode::FLOAT_MULTIPLY:
+        case OpCode::FLOAT_DIVIDE:
+            --m_Depth;
+            break;
+
+        default:
+            // Strings are not evaluated on the stack.
+            break;
+    }
+
+    m_MaxDepth = std::max(m_MaxDepth, m_Depth);
+    m_Code.push_back({opCode, operand, 0.0});
+}
+
+void PARSER::ExpressionProgram::EmitFloat(double value)
+{
+    Emit(OpCode::FLOAT_CONSTANT);
+    m_Code.back().m_Float = value;
+}
+
+void PARSER::ExpressionProgram::EmitString(const std::string &rString)
+{
+    if (!m_Code.empty() && (OpCode::STRING_CONSTANT == m_Code.back().m_OpCode))
+    {
+        m_Strings[m_Code.back().m_Operand] += rString;
+        return;
+    }
+
+    Emit(OpCode::STRING_CONSTANT, m_Strings.size());
+    m_Strings.push_back(rString);
+}
+
+bool PARSER::ExpressionProgram::FoldUint(const ExpressionNode &rNode)
+{
+    if (!rNode.IsConstant())
+    {
+        return false;
+    }
+
+    try
+    {
+        Emit(OpCode::UINT_CONSTANT, rNode.EvaluateUint().GetValue());
+    }
+    catch (const EXCEPTIONS::EvaluatorException &)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool PARSER::ExpressionProgram::FoldDouble(const ExpressionNode &rNode)
+{
+    if (!rNode.IsConstant())
+    {
+        return false;
+    }
+
+    try
+    {
+        EmitFloat(rNode.EvaluateDouble().GetFloatValue());
+    }
+    catch (const EXCEPTIONS::EvaluatorException &)
+    {
+        return false;
+    }
+    return true;
+}
+
+SafeUInt<uint64_t> PARSER::ExpressionProgram::EvaluateUint(const ExpressionContext &rContext) const
+{
+    if (m_Code.empty())
+    {
+        return 0;
+    }
+
+    Stack<SafeUInt<uint64_t>> stack(m_MaxDepth);
+
+    for (const Instruction &rInstruction : m_Code)
+    {
+        switch (rInstruction.m_OpCode)
+        {
+            case OpCode::UINT_CONSTANT:
+                stack.Push(rInstruction.m_Operand);
+                break;
+
+            case OpCode::UINT_DEC:
+                stack.Push(ConvertUint(rContext, rInstruction.m_Operand, CaptureCache::Conversion::DEC));
+                break;
+
+            case OpCode::UINT_HEX:
+                stack.Push(ConvertUint(rContext, rInstruction.m_Operand, CaptureCache::Conversion::HEX));
+                break;
+
+            case OpCode::UINT_LINE:
+                stack.Push(rContext.GetLineNo());
+                break;
+
+            case OpCode::UINT_ADD:
+            {
+                SafeUInt<uint64_t> left = stack.Pop();
+                SafeUInt<uint64_t> right = stack.Pop();
+                try
+                {
+                    stack.Push(left + right);
+                }
+                catch (const std::out_of_range &)
+                {
+                    throw EXCEPTIONS::Overflow("Overflow while adding.");
+                }
+                break;
+            }
+
+            case OpCode::UINT_SUBTRACT:
+            {
+                SafeUInt<uint64_t> left = stack.Pop();
+                SafeUInt<uint64_t> right = stack.Pop();
+                try
+                {
+                    stack.Push(left - right);
+                }
+                catch (const std::out_of_range &)
+                {
+                    throw EXCEPTIONS::Overflow("Underflow while substracting.");
+                }
+                break;
+            }
+
+            case OpCode::UINT_MULTIPLY:
+            {
+                SafeUInt<uint64_t> left = stack.Pop();
+                SafeUInt<uint64_t> right = stack.Pop();
+                try
+                {
+                    stack.Push(left * right);
+                }
+                catch (const std::out_of_range &)
+                {
+                    throw EXCEPTIONS::Overflow("Overflow while multiplying.");
+                }
+                break;
+            }
+
+            case OpCode::UINT_CHECK_DIVISOR:
+                if (0 == stack.Top().GetValue())
+                {
+                    throw EXCEPTIONS::DivByZero("");
+                }
+                break;
+
+            case OpCode::UINT_DIVIDE:
+            {
+                SafeUInt<uint64_t> left = stack.Pop();
+                SafeUInt<uint64_t> right = stack.Pop();
+                stack.Push(left / right);
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    return stack.Pop();
+}
+
+PARSER::FloatResult PARSER::ExpressionProgram::EvaluateDouble(const ExpressionContext &rContext) const
+{
+    if (m_Code.empty())
+    {
+        return FloatResult(0.0);
+    }
+
+    if ((1 == m_Code.size()) && (OpCode::FLOAT_FLT == m_Code.front().m_OpCode))
+    {
+        return ConvertFloat(rContext, m_Code.front().m_Operand);
+    }
+
+    Stack<double> stack(m_MaxDepth);
+
+    for (const Instruction &rInstruction : m_Code)
+    {
+        switch (rInstruction.m_OpCode)
+        {
+            case OpCode::FLOAT_CONSTANT:
+                stack.Push(rInstruction.m_Float);
+                break;
+
+            case OpCode::FLOAT_FLT:
+                stack.Push(ConvertFloat(rContext, rInstruction.m_Operand).GetFloatValue());
+                break;
+
+            case OpCode::FLOAT_NEGATE:
+                stack.Push(-stack.Pop());
+                break;
+
+            case OpCode::FLOAT_ADD:
+            {
+                double rightValue = stack.Pop();
+                double leftValue = stack.Pop();
+
+                if ((std::numeric_limits<double>::max() - leftValue) < rightValue)
+                {
+                    throw EXCEPTIONS::Overflow("Overflow while adding.");
+                }
+                stack.Push(leftValue + rightValue);
+                break;
+            }
+
+            case OpCode::FLOAT_SUBTRACT:
+            {
+                double rightValue = stack.Pop();
+                double leftValue = stack.Pop();
+
+                if ((std::numeric_limits<double>::min() + rightValue) > leftValue)
+                {
+                    throw EXCEPTIONS::Overflow("Underflow while substracting.");
+                }
+                stack.Push(leftValue - rightValue);
+                break;
+            }
+
+            case OpCode::FLOAT_MULTIPLY:
+            {
+                double rightValue = stack.Pop();
+                double leftValue = stack.Pop();
+
+                if ((std::numeric_limits<double>::max() / leftValue) < rightValue)
+                {
+                    throw EXCEPTIONS::Overflow("Overflow while multiplying.");
+                }
+                stack.Push(leftValue * rightValue);
+                break;
+            }
+
+            case OpCode::FLOAT_DIVIDE:
+            {
+                double rightValue = stack.Pop();
+                double leftValue = stack.Pop();
+
+                if (0 == rightValue)
+                {
+                    throw EXCEPTIONS::DivByZero("");
+                }
+                stack.Push(leftValue / rightValue);
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    return FloatResult(stack.Pop());
+}
+
+std::string PARSER::ExpressionProgram::EvaluateString(const ExpressionContext &rContext) const
+{
+    // The tree evaluated the concatenated groups right to left. They are
+    // looked up in the same order to report the same invalid index.
+    size_t length = 0;
+    for (auto it = m_Code.rbegin(); it != m_Code.rend(); ++it)
+    {
+        if (OpCode::STRING_TXT == it->m_OpCode)
+        {
+            length += rContext.GetElement(it->m_Operand).size();
+        }
+        else
+        {
+            length += m_Strings[it->m_Operand].size();
+        }
+    }
+
+    std::string value;
+    value.reserve(length);
+
+    for (const Instruction &rInstruction : m_Code)
+    {
+        if (OpCode::STRING_TXT == rInstruction.m_OpCode)
+        {
+            value += rContext.GetElement(rInstruction.m_Operand);
+        }
+        else
+        {
+            value += m_Strings[rInstruction.m_Operand];
+        }
+    }
+
+    return value;
+}
+
+SafeUInt<uint64_t> PARSER::ExpressionProgram::ConvertUint(const ExpressionContext &rContext,
+                                                          size_t index,
+                                                          CaptureCache::Conversion conversion)
+{
+    CaptureCache *pCache = rContext.GetCache();
+    uint64_t value = 0;
+
+    if ((nullptr != pCache) && pCache->FindUint(conversion, index, value))
+    {
+        return value;
+    }
+
+    const SafeUInt<uint64_t> result = (CaptureCache::Conversion::HEX == conversion) ?
+                                      ConvertElement(rContext.GetElement(index), 16, "Cannot convert to hex: ") :
+                                      ConvertElement(rContext.GetElement(index), 10, "Cannot convert to decimal: ");
+
+    if (nullptr != pCache)
+    {
+        pCache->StoreUint(conversion, index, result.GetValue());
+    }
+    return result;
+}
+
+PARSER::FloatResult PARSER::ExpressionProgram::ConvertFloat(const ExpressionContext &rContext, size_t index)
+{
+    const std::string_view element = rContext.GetElement(index);
+    CaptureCache *pCache = rContext.GetCache();
+    double value = 0.0;
+
+    if ((nullptr != pCache) && pCache->FindFloat(index, value))
+    {
+        return FloatResult(element, value);
+    }
+
+    const FloatResult result(element);
+
+    if (nullptr != pCache)
+    {
+        pCache->StoreFloat(index, result.GetFloatValue());
+    }
+    return result;
+}
@@ -31,9 +31,7 @@
 
 PARSER::FloatResult PARSER::FNFlt::EvaluateDouble() const
 {
-    std::string stringValue(m_rContext.GetElement(m_Index));
-
-    return FloatResult(stringValue);
+    return FloatResult(m_rContext.GetElement(m_Index));
 }
 
 PARSER::FloatResult PARSER::FNNegate::EvaluateDouble() const
@@ -93,3 +91,52 @@ PARSER::FloatResult PARSER::FNDivide::EvaluateDouble() const
 
     return FloatResult(leftValue / rightValue);
 }
+
+void PARSER::FNNegate::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldDouble(*this))
+    {
+        m_pNode->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::FLOAT_NEGATE);
+    }
+}
+
+void PARSER::FNAdd::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldDouble(*this))
+    {
+        m_pLeft->Compile(rProgram);
+        m_pRight->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::FLOAT_ADD);
+    }
+}
+
+void PARSER::FNSubtract::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldDouble(*this))
+    {
+        m_pLeft->Compile(rProgram);
+        m_pRight->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::FLOAT_SUBTRACT);
+    }
+}
+
+void PARSER::FNMultiply::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldDouble(*this))
+    {
+        m_pLeft->Compile(rProgram);
+        m_pRight->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::FLOAT_MULTIPLY);
+    }
+}
+
+void PARSER::FNDivide::Compile(ExpressionProgram &rProgram) const
+{
+    if (!rProgram.FoldDouble(*this))
+    {
+        m_pLeft->Compile(rProgram);
+        m_pRight->Compile(rProgram);
+        rProgram.Emit(ExpressionProgram::OpCode::FLOAT_DIVIDE);
+    }
+}
@@ -29,21 +29,21 @@
 
 #include "FloatResult.h"
 #include "EvaluatorExceptions.h"
+#include "NumberConverter.h"
 
-PARSER::FloatResult::FloatResult(const std::string &rFloatString) :
-    m_String(rFloatString)
+PARSER::FloatResult::FloatResult(std::string_view floatString) :
+    m_String(floatString)
 {
-    try
-    {
-        m_Value = std::stod(rFloatString, nullptr);
-    }
-    catch (const std::invalid_argument &)
+    const UTILS::ConversionStatus status = UTILS::NumberConverter::ConvertFloat(floatString, m_Value);
+
+    if (UTILS::ConversionStatus::INVALID == status)
     {
-        throw EXCEPTIONS::ConversionError("Cannot convert to double: ", rFloatString);
+        throw EXCEPTIONS::ConversionError("Cannot convert to double: ", std::string(floatString));
     }
-    catch (const std::out_of_range &)
+
+    if (UTILS::ConversionStatus::OUT_OF_RANGE == status)
     {
-        throw EXCEPTIONS::Overflow("Out of range double value: " + rFloatString);
+        throw EXCEPTIONS::Overflow("Out of range double value: " + std::string(floatString));
     }
 }
 
@@ -53,5 +53,5 @@ std::string PARSER::FloatResult::GetFloatString() const
     {
         return std::to_string(m_Value);
     }
-    return m_String;
+    return std::string(m_String);
 }
@@ -48,8 +48,14 @@ namespace CLI
             {
                 m_Cli.add(m_Timebase);
                 m_Cli.add(m_UserLogFormat);
+                m_Cli.add(m_InputFormat);
                 m_Cli.add(m_FileIn);
                 m_Cli.add(m_LineCounter);
+                m_Cli.add(m_StreamingMode);
+                m_Cli.add(m_ReorderTime);
+                m_Cli.add(m_ReorderEvents);
+                m_Cli.add(m_MemoryBudget);
+                m_Cli.add(m_DropUnchanged);
             }
 
             /// Returns the timebase parameter.
@@ -64,6 +70,12 @@ namespace CLI
                 return m_UserLogFormat.getValue();
             }
 
+            /// Returns the input log format parameter.
+            const std::string &GetInputFormat()
+            {
+                return m_InputFormat.getValue();
+            }
+
             /// Returns the input filename.
             const std::string &GetInputFileName()
             {
@@ -76,6 +88,49 @@ namespace CLI
                 return m_LineCounter.getValue();
             }
 
+            /// Returns the streaming mode value.
+            ///
+            /// Returns 'true' for the streaming mode enabled.
+            /// Setting a reorder window enables the streaming mode too.
+            bool IsStreamingMode()
+            {
+                return (m_StreamingMode.getValue() ||
+                        (0 != GetReorderTime()) ||
+                        (0 != GetReorderEvents()));
+            }
+
+            /// Returns the reorder window time.
+            ///
+            /// Returns 0 if the window is not given in time.
+            uint64_t GetReorderTime()
+            {
+                return m_ReorderTime.getValue();
+            }
+
+            /// Returns the reorder window number of events.
+            ///
+            /// Returns 0 if the window is not given in events.
+            uint64_t GetReorderEvents()
+            {
+                return m_ReorderEvents.getValue();
+            }
+
+            /// Returns the maximum number of signals kept in memory.
+            ///
+            /// Returns 0 if the number is not limited.
+            uint64_t GetMemoryBudget()
+            {
+                return m_MemoryBudget.getValue();
+            }
+
+            /// Returns the unchanged values dropping switch value.
+            ///
+            /// Returns 'true' if the unchanged values are dropped while parsing.
+            bool IsDroppingUnchanged()
+            {
+                return m_DropUnchanged.getValue();
+            }
+
         private:
 
             /// Valid timebases constraint.
@@ -91,6 +146,16 @@ namespace CLI
             TCLAP::ValueArg<std::string> m_UserLogFormat
                 { "u", "user_format", "The user log format XML description", false, "", "user-log-format" };
 
+            /// Valid input log formats.
+            std::vector<std::string> m_AllowedInputFormatsTclap{"txt", "csv", "binary", "pcap"};
+
+            /// Valid input log formats constraint.
+            TCLAP::ValuesConstraint<std::string> m_AllowedInputFormats{m_AllowedInputFormatsTclap};
+
+            /// Input log format parameter.
+            TCLAP::ValueArg<std::string> m_InputFormat
+                { "f", "input_format", "Input log format", false, "txt", &m_AllowedInputFormats };
+
             /// Input filename parameter.
             TCLAP::UnlabeledValueArg<std::string> m_FileIn
                 { "file_in", "Input log filename", true, "log.txt", "input-file" };
@@ -98,6 +163,26 @@ namespace CLI
             /// Line counter parameter.
             TCLAP::ValueArg<std::string> m_LineCounter
                 { "c", "line_counter", "Line counter signal name", false, "", "line-counter-signal-name"};
+
+            /// Streaming mode switch state.
+            TCLAP::SwitchArg m_StreamingMode
+                { "s", "streaming", "Enables the streaming mode for time-sorted logs", false};
+
+            /// Reorder window time parameter.
+            TCLAP::ValueArg<uint64_t> m_ReorderTime
+                { "r", "reorder_time", "Reorder window size in the log time units", false, 0, "reorder-time"};
+
+            /// Reorder window events parameter.
+            TCLAP::ValueArg<uint64_t> m_ReorderEvents
+                { "e", "reorder_events", "Reorder window size in the number of signals", false, 0, "reorder-events"};
+
+            /// Memory budget parameter.
+            TCLAP::ValueArg<uint64_t> m_MemoryBudget
+                { "m", "memory_budget", "Maximum number of signals kept in memory", false, 0, "memory-budget"};
+
+            /// Unchanged values dropping switch state.
+            TCLAP::SwitchArg m_DropUnchanged
+                { "d", "drop_unchanged", "Drops the signals not changing the values while parsing", false};
     };
 
 }
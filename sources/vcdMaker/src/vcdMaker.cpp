@@ -25,8 +25,12 @@
 #include <memory>
 
 #include "VCDTracer.h"
+#include "ReorderWindow.h"
 #include "CliMaker.h"
 #include "TxtParser.h"
+#include "CsvParser.h"
+#include "BinaryParser.h"
+#include "PcapParser.h"
 #include "SourceRegistry.h"
 #include "LineCounter.h"
 #include "VcdException.h"
@@ -53,11 +57,49 @@ int main(int argc, const char *argv[])
         CLI::CliMaker cli;
         cli.Parse(argc, argv);
 
-        // Build the signal factory.
+        // The line counter needs all the signals of a timestamp at once.
+        if (cli.IsStreamingMode() && !cli.GetLineCounterName().empty())
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INCOMPATIBLE_OPTIONS,
+                                          "The line counter cannot be used in the streaming mode.");
+        }
+
+        if ((0 != cli.GetReorderTime()) && (0 != cli.GetReorderEvents()))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INCOMPATIBLE_OPTIONS,
+                                          "The reorder window cannot be given both in time and in events.");
+        }
+
+        // The reordered signals would be compared in the log order.
+        if (cli.IsDroppingUnchanged() && ((0 != cli.GetReorderTime()) || (0 != cli.GetReorderEvents())))
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INCOMPATIBLE_OPTIONS,
+                                          "Unchanged values cannot be dropped in the reorder window mode.");
+        }
+
+        // The CSV columns and the binary records or datagrams are described in the user XML file.
+        const std::string &rInputFormat = cli.GetInputFormat();
+        if (("txt" != rInputFormat) && cli.GetUserLogFormat().empty())
+        {
+            throw EXCEPTION::VcdException(EXCEPTION::Error::INCOMPATIBLE_OPTIONS,
+                                          "The " + rInputFormat + " log format requires the user format description.");
+        }
+
+        // Build the signal factory or the log layout.
         std::unique_ptr<PARSER::SignalFactory> pSignalFactory = NULL;
-        if (!cli.GetUserLogFormat().empty())
+        std::unique_ptr<PARSER::CsvLayout> pCsvLayout = NULL;
+        std::unique_ptr<PARSER::BinaryLayout> pBinaryLayout = NULL;
+        if ("csv" == rInputFormat)
+        {
+            pCsvLayout = std::make_unique<PARSER::CsvLayout>(cli.GetUserLogFormat());
+        }
+        else if (("binary" == rInputFormat) || ("pcap" == rInputFormat))
+        {
+            pBinaryLayout = std::make_unique<PARSER::BinaryLayout>(cli.GetUserLogFormat());
+        }
+        else if (!cli.GetUserLogFormat().empty())
         {
-            pSignalFactory = std::make_unique<PARSER::XmlSignalFactory>(cli.GetUserLogFormat());
+            pSignalFactory = std::make_unique<PARSER::XmlSignalFactory>(cli.GetUserLogFormat(), cli.GetTimebase());
         }
         else
         {
@@ -65,11 +107,39 @@ int main(int argc, const char *argv[])
         }
 
         // Create the log parser.
-        PARSER::TxtParser txtLog(cli.GetInputFileName(),
-                                 cli.GetTimebase(),
-                                 SIGNAL::SourceRegistry::GetInstance(),
-                                 *pSignalFactory,
-                                 cli.IsVerboseMode());
+        std::unique_ptr<PARSER::LogParser> pLog = NULL;
+        if (pCsvLayout)
+        {
+            pLog = std::make_unique<PARSER::CsvParser>(cli.GetInputFileName(),
+                                                       cli.GetTimebase(),
+                                                       SIGNAL::SourceRegistry::GetInstance(),
+                                                       *pCsvLayout,
+                                                       cli.IsVerboseMode());
+        }
+        else if (pBinaryLayout && ("pcap" == rInputFormat))
+        {
+            pLog = std::make_unique<PARSER::PcapParser>(cli.GetInputFileName(),
+                                                        cli.GetTimebase(),
+                                                        SIGNAL::SourceRegistry::GetInstance(),
+                                                        *pBinaryLayout,
+                                                        cli.IsVerboseMode());
+        }
+        else if (pBinaryLayout)
+        {
+            pLog = std::make_unique<PARSER::BinaryParser>(cli.GetInputFileName(),
+                                                          cli.GetTimebase(),
+                                                          SIGNAL::SourceRegistry::GetInstance(),
+                                                          *pBinaryLayout,
+                                                          cli.IsVerboseMode());
+        }
+        else
+        {
+            pLog = std::make_unique<PARSER::TxtParser>(cli.GetInputFileName(),
+                                                       cli.GetTimebase(),
+                                                       SIGNAL::SourceRegistry::GetInstance(),
+                                                       *pSignalFactory,
+                                                       cli.IsVerboseMode());
+        }
 
         // Line counter.
         std::unique_ptr<INSTRUMENT::LineCounter> lineCounter;
@@ -80,17 +150,51 @@ int main(int argc, const char *argv[])
             lineCounter = std::make_unique<INSTRUMENT::LineCounter>(cli.GetInputFileName(),
                                                                     cli.GetLineCounterName(),
                                                                     SIGNAL::SourceRegistry::GetInstance(),
-                                                                    txtLog.GetSignalDb());
-            txtLog.Attach(*lineCounter);
+                                                                    pLog->GetSignalDb());
+            pLog->Attach(*lineCounter);
         }
 
-        // Start parsing.
-        txtLog.Execute();
+        // Only the value changes are kept.
+        pLog->GetSignalDb().SetUnchangedDropping(cli.IsDroppingUnchanged());
 
-        // Create the VCD tracer and dump the output file.
-        TRACER::VCDTracer vcd_trace(cli.GetOutputFileName(),
-                                    txtLog.GetSignalDb());
-        vcd_trace.Dump();
+        if (cli.IsStreamingMode())
+        {
+            // Stream the signals straight to the output file.
+            TRACER::VCDTracer vcd_trace(cli.GetOutputFileName(),
+                                        pLog->GetSignalDb());
+
+            if (0 != cli.GetReorderTime())
+            {
+                TRACER::ReorderWindow window(vcd_trace,
+                                             TRACER::ReorderWindow::WindowT::TIME,
+                                             cli.GetReorderTime());
+                pLog->Stream(window);
+            }
+            else if (0 != cli.GetReorderEvents())
+            {
+                TRACER::ReorderWindow window(vcd_trace,
+                                             TRACER::ReorderWindow::WindowT::EVENTS,
+                                             cli.GetReorderEvents());
+                pLog->Stream(window);
+            }
+            else
+            {
+                pLog->Stream(vcd_trace);
+            }
+        }
+        else
+        {
+            // Signals beyond the budget are spilled to temporary files.
+            pLog->GetSignalDb().SetMemoryBudget(cli.GetMemoryBudget());
+
+            // Start parsing.
+            pLog->Execute();
+
+            // Create the VCD tracer and dump the output file.
+            TRACER::VCDTracer vcd_trace(cli.GetOutputFileName(),
+                                        pLog->GetSignalDb());
+            vcd_trace.Dump();
+        }
     }
     catch (const EXCEPTION::VcdException &rException)
     {
@@ -70,7 +70,7 @@ namespace MERGE
             void Run();
 
             /// Returns the merged signals database.
-            const SIGNAL::SignalDb &GetSignals() const
+            SIGNAL::SignalDb &GetSignals()
             {
                 return *(m_pMerged.get());
             }
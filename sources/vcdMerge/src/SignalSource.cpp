@@ -105,6 +105,9 @@ void MERGE::SignalSource::Create()
     parser.Execute();
 
     m_pSignalDb = parser.MoveSignalDb();
+
+    // The leading time is the timestamp of the first signal.
+    m_pSignalDb->Finalize();
 }
 
 void MERGE::SignalSource::SetFormat(const std::string &rFormat)
@@ -128,7 +131,7 @@ void MERGE::SignalSource::SetFormat(const std::string &rFormat)
             ThrowFileInaccessibleException(filename);
         }
 
-        m_pSignalFactory = std::make_unique<PARSER::XmlSignalFactory>(filename);
+        m_pSignalFactory = std::make_unique<PARSER::XmlSignalFactory>(filename, m_TimeUnit);
         return;
     }
 
@@ -203,9 +206,10 @@ void MERGE::SignalSource::ParseParameters()
     }
     else
     {
+        // The user format timestamps are converted to the time unit.
+        SetTimeUnit(params[Parameters::TIME_UNIT]);
         SetFormat(params[Parameters::LOG_FORMAT]);
         SetSyncPoint(params[Parameters::SYNC_POINT]);
-        SetTimeUnit(params[Parameters::TIME_UNIT]);
         SetPrefix(params[Parameters::PREFIX]);
         SetCounterName(params[Parameters::LINE_COUNTER]);
         SetFilename(params[Parameters::FILENAME]);
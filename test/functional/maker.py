@@ -45,7 +45,13 @@ class Maker(Test):
         self.unique_params = {'input_file': ['', 'Missing input file'],
                               'time_unit': ['', 'Missing time unit'],
                               'line_counter': ['', ''],
-                              'user_format': ['', '']}
+                              'user_format': ['', ''],
+                              'input_format': ['', ''],
+                              'streaming': ['', ''],
+                              'reorder_time': ['', ''],
+                              'reorder_events': ['', ''],
+                              'memory_budget': ['', ''],
+                              'drop_unchanged': ['', '']}
 
         for element in node.iter(tag='unique'):
             self.unique = Flat(element, self.unique_params)
@@ -62,10 +68,32 @@ class Maker(Test):
             self.command.append('-c')
             self.command.append(self.unique.get_parameter('line_counter'))
 
+        if self.unique.get_parameter('streaming'):
+            self.command.append('-s')
+
+        if self.unique.get_parameter('reorder_time'):
+            self.command.append('-r')
+            self.command.append(self.unique.get_parameter('reorder_time'))
+
+        if self.unique.get_parameter('reorder_events'):
+            self.command.append('-e')
+            self.command.append(self.unique.get_parameter('reorder_events'))
+
+        if self.unique.get_parameter('memory_budget'):
+            self.command.append('-m')
+            self.command.append(self.unique.get_parameter('memory_budget'))
+
+        if self.unique.get_parameter('drop_unchanged'):
+            self.command.append('-d')
+
         if self.unique.get_parameter('user_format'):
             self.command.append('-u')
             self.command.append(self.unique.get_parameter('user_format'))
 
+        if self.unique.get_parameter('input_format'):
+            self.command.append('-f')
+            self.command.append(self.unique.get_parameter('input_format'))
+
         self.command.append('-o')
         self.command.append(os.path.join(test_directory,
                                          self.common.get_parameter('output_file')))